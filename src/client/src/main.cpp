@@ -1,4 +1,5 @@
 #include "../../common/command/Command.hpp"
+#include "../../common/frame/Frame.hpp"
 #include "../../common/log/Exception.hpp"
 #include "network/Connection.hpp"
 
@@ -10,6 +11,8 @@
 
 auto shieldSignal(std::source_location sourceLocation = std::source_location::current()) -> void;
 
+auto splitArguments(std::string_view data) -> std::vector<std::string>;
+
 auto formatRequest(std::string_view data, unsigned long &id) -> std::vector<std::byte>;
 
 auto main() -> int {
@@ -17,7 +20,7 @@ auto main() -> int {
 
     constexpr std::string_view host{"127.0.0.1"};
     constexpr unsigned short port{9090};
-    const Connection connection{host, port};
+    Connection connection{host, port};
 
     unsigned long databaseIndex{};
     bool isTransaction{};
@@ -32,7 +35,7 @@ auto main() -> int {
         std::string input;
         std::getline(std::cin, input);
 
-        if (input.empty()) continue;
+        if (input.find_first_not_of(' ') == std::string::npos) continue;
         if (input == "QUIT") break;
 
         if (input == "MULTI") {
@@ -48,10 +51,22 @@ auto main() -> int {
 
             continue;
         }
+        if (const std::string name{splitArguments(input).front()}; input != "EXEC" && !toCommand(name).has_value()) {
+            std::println("(error) ERR unknown command '{}'", name);
+
+            continue;
+        }
+
         if (input == "EXEC") {
             if (!transaction.empty()) {
+                std::vector<std::byte> requests;
+                for (const auto &request : transaction) {
+                    const std::vector subRequests{formatRequest(request, databaseIndex)};
+                    requests.insert(requests.cend(), subRequests.cbegin(), subRequests.cend());
+                }
+                connection.send(requests);
+
                 for (unsigned long i{}; i < transaction.size(); ++i) {
-                    connection.send(formatRequest(transaction[i], databaseIndex));
                     const std::vector data{connection.receive()};
 
                     std::println("{}{}", std::to_string(i + 1) + ") ",
@@ -93,60 +108,59 @@ auto shieldSignal(const std::source_location sourceLocation) -> void {
     }
 }
 
-auto formatRequest(std::string_view data, unsigned long &id) -> std::vector<std::byte> {
-    const unsigned long space{data.find(' ')};
-    const auto command{data.substr(0, space)};
-    auto statement{data.substr(space + 1)};
-
-    Command commandType{};
-    if (command == "SELECT") {
-        commandType = Command::select;
-        id = std::stoul(std::string{statement});
-        statement = {};
-    } else if (command == "DEL") commandType = Command::del;
-    else if (command == "EXISTS") commandType = Command::exists;
-    else if (command == "MOVE") commandType = Command::move;
-    else if (command == "RENAME") commandType = Command::rename;
-    else if (command == "RENAMENX") commandType = Command::renamenx;
-    else if (command == "TYPE") commandType = Command::type;
-    else if (command == "SET") commandType = Command::set;
-    else if (command == "GET") commandType = Command::get;
-    else if (command == "GETRANGE") commandType = Command::getRange;
-    else if (command == "GETBIT") commandType = Command::getBit;
-    else if (command == "SETBIT") commandType = Command::setBit;
-    else if (command == "MGET") commandType = Command::mget;
-    else if (command == "SETNX") commandType = Command::setnx;
-    else if (command == "SETRANGE") commandType = Command::setRange;
-    else if (command == "STRLEN") commandType = Command::strlen;
-    else if (command == "MSET") commandType = Command::mset;
-    else if (command == "MSETNX") commandType = Command::msetnx;
-    else if (command == "INCR") commandType = Command::incr;
-    else if (command == "INCRBY") commandType = Command::incrBy;
-    else if (command == "DECR") commandType = Command::decr;
-    else if (command == "DECRBY") commandType = Command::decrBy;
-    else if (command == "APPEND") commandType = Command::append;
-    else if (command == "HDEL") commandType = Command::hdel;
-    else if (command == "HEXISTS") commandType = Command::hexists;
-    else if (command == "HGET") commandType = Command::hget;
-    else if (command == "HGETALL") commandType = Command::hgetAll;
-    else if (command == "HINCRBY") commandType = Command::hincrBy;
-    else if (command == "HKEYS") commandType = Command::hkeys;
-    else if (command == "HLEN") commandType = Command::hlen;
-    else if (command == "HSET") commandType = Command::hset;
-    else if (command == "HVALS") commandType = Command::hvals;
-    else if (command == "LINDEX") commandType = Command::lindex;
-    else if (command == "LLEN") commandType = Command::llen;
-    else if (command == "LPOP") commandType = Command::lpop;
-    else if (command == "LPUSH") commandType = Command::lpush;
-    else if (command == "LPUSHX") commandType = Command::lpushx;
-
-    std::vector buffer{std::byte{std::to_underlying(commandType)}};
-
-    buffer.resize(buffer.size() + sizeof(id));
-    *reinterpret_cast<std::remove_reference_t<decltype(id)> *>(buffer.data() + buffer.size() - sizeof(id)) = id;
-
-    const auto bytes{std::as_bytes(std::span{statement})};
-    buffer.insert(buffer.cend(), bytes.cbegin(), bytes.cend());
+auto splitArguments(const std::string_view data) -> std::vector<std::string> {
+    std::vector<std::string> arguments;
+    for (unsigned long position{}; position < data.size();) {
+        if (data[position] == ' ') {
+            ++position;
+
+            continue;
+        }
+
+        std::string argument;
+        while (position < data.size() && data[position] != ' ') {
+            if (const char quote{data[position]}; quote == '"' || quote == '\'') {
+                for (++position; position < data.size() && data[position] != quote; ++position) {
+                    if (quote == '"' && data[position] == '\\' && position + 1 < data.size()) {
+                        switch (data[++position]) {
+                            case 'n':
+                                argument += '\n';
+                                break;
+                            case 'r':
+                                argument += '\r';
+                                break;
+                            case 't':
+                                argument += '\t';
+                                break;
+                            default:
+                                argument += data[position];
+                        }
+                    } else argument += data[position];
+                }
+                ++position;
+            } else argument += data[position++];
+        }
+        arguments.emplace_back(std::move(argument));
+    }
+
+    return arguments;
+}
+
+auto formatRequest(const std::string_view data, unsigned long &id) -> std::vector<std::byte> {
+    const std::vector arguments{splitArguments(data)};
+    const Command command{*toCommand(arguments.front())};
+    if (command == Command::select) id = std::stoul(arguments.at(1));
+
+    std::vector payload{std::byte{std::to_underlying(command)}};
+
+    payload.resize(payload.size() + sizeof(id));
+    *reinterpret_cast<std::remove_reference_t<decltype(id)> *>(payload.data() + payload.size() - sizeof(id)) = id;
+
+    const std::vector<std::string_view> parameters{arguments.cbegin() + 1, arguments.cend()};
+    Frame::encodeArguments(payload, parameters);
+
+    std::vector<std::byte> buffer;
+    Frame::encode(buffer, payload);
 
     return buffer;
 }
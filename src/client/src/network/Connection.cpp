@@ -1,5 +1,6 @@
 #include "Connection.hpp"
 
+#include "../../../common/frame/Frame.hpp"
 #include "../../../common/log/Exception.hpp"
 
 #include <arpa/inet.h>
@@ -20,7 +21,8 @@ Connection::Connection(const std::string_view host, const unsigned short port) :
         return fileDescriptor;
     }()} {}
 
-Connection::Connection(Connection &&other) noexcept : fileDescriptor{std::exchange(other.fileDescriptor, -1)} {}
+Connection::Connection(Connection &&other) noexcept :
+    fileDescriptor{std::exchange(other.fileDescriptor, -1)}, buffer{std::move(other.buffer)} {}
 
 auto Connection::operator=(Connection &&other) noexcept -> Connection & {
     if (this == &other) return *this;
@@ -28,6 +30,7 @@ auto Connection::operator=(Connection &&other) noexcept -> Connection & {
     this->close();
 
     this->fileDescriptor = std::exchange(other.fileDescriptor, -1);
+    this->buffer = std::move(other.buffer);
 
     return *this;
 }
@@ -42,29 +45,27 @@ auto Connection::send(const std::span<const std::byte> data, const std::source_l
     }
 }
 
-auto Connection::receive(const std::source_location sourceLocation) const -> std::vector<std::byte> {
-    std::vector<std::byte> buffer;
-
+auto Connection::receive(const std::source_location sourceLocation) -> std::vector<std::byte> {
     while (true) {
-        std::vector<std::byte> subBuffer{1024};
-        if (const long result{recv(this->fileDescriptor, subBuffer.data(), subBuffer.size(), MSG_DONTWAIT)};
-            result > 0) {
-            subBuffer.resize(result);
-            buffer.insert(buffer.cend(), subBuffer.cbegin(), subBuffer.cend());
-        } else {
-            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
-                if (buffer.empty()) continue;
+        std::span<const std::byte> data{this->buffer};
+        if (const std::optional response{Frame::decode(data)}; response.has_value()) {
+            std::vector<std::byte> result{response->begin(), response->end()};
+            this->buffer.erase(this->buffer.cbegin(), this->buffer.cend() - static_cast<long>(data.size()));
 
-                break;
-            }
+            return result;
+        }
 
+        std::vector<std::byte> subBuffer{1024};
+        if (const long result{recv(this->fileDescriptor, subBuffer.data(), subBuffer.size(), 0)}; result > 0) {
+            subBuffer.resize(result);
+            this->buffer.insert(this->buffer.cend(), subBuffer.cbegin(), subBuffer.cend());
+        } else if (result != 0 && errno == EINTR) continue;
+        else {
             throw Exception{
                 Log{Log::Level::fatal, result == 0 ? "connection closed" : std::strerror(errno), sourceLocation}
             };
         }
     }
-
-    return buffer;
 }
 
 auto Connection::socket(const std::source_location sourceLocation) -> int {
@@ -23,7 +23,7 @@ public:
     auto send(std::span<const std::byte> data,
               std::source_location sourceLocation = std::source_location::current()) const -> void;
 
-    [[nodiscard]] auto receive(std::source_location sourceLocation = std::source_location::current()) const
+    [[nodiscard]] auto receive(std::source_location sourceLocation = std::source_location::current())
         -> std::vector<std::byte>;
 
 private:
@@ -38,4 +38,5 @@ private:
     auto close(std::source_location sourceLocation = std::source_location::current()) const -> void;
 
     int fileDescriptor;
+    std::vector<std::byte> buffer;
 };
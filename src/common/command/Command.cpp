@@ -1 +1,149 @@
 #include "Command.hpp"
+
+#include <algorithm>
+#include <array>
+
+using enum CommandSpecification::Lock;
+
+static constexpr std::array<CommandSpecification, commandCount> specifications{{
+    {"SELECT", Command::select, 2, 0, 0, 0, true, false, exclusive},
+    {"DEL", Command::del, -2, 1, -1, 1, true, false, shared},
+    {"EXISTS", Command::exists, -2, 1, -1, 1, false, false, none},
+    {"MOVE", Command::move, 3, 1, 1, 1, true, false, shared},
+    {"RENAME", Command::rename, 3, 1, 2, 1, true, false, shared},
+    {"RENAMENX", Command::renamenx, 3, 1, 2, 1, true, false, shared},
+    {"TYPE", Command::type, 2, 1, 1, 1, false, false, shared},
+    {"SCAN", Command::scan, -2, 0, 0, 0, false, false, shared},
+    {"RANGE", Command::range, -3, 0, 0, 0, false, false, shared},
+    {"EXPIRE", Command::expire, 3, 1, 1, 1, true, false, shared},
+    {"EXPIREAT", Command::expireAt, 3, 1, 1, 1, true, false, shared},
+    {"PEXPIRE", Command::pexpire, 3, 1, 1, 1, true, false, shared},
+    {"PEXPIREAT", Command::pexpireAt, 3, 1, 1, 1, true, false, shared},
+    {"PERSIST", Command::persist, 2, 1, 1, 1, true, false, shared},
+    {"PTTL", Command::pttl, 2, 1, 1, 1, false, false, shared},
+    {"TTL", Command::ttl, 2, 1, 1, 1, false, false, shared},
+    {"SET", Command::set, -3, 1, 1, 1, true, true, shared},
+    {"GET", Command::get, 2, 1, 1, 1, false, false, none},
+    {"GETRANGE", Command::getRange, 4, 1, 1, 1, false, false, shared},
+    {"GETBIT", Command::getBit, 3, 1, 1, 1, false, false, shared},
+    {"SETBIT", Command::setBit, 4, 1, 1, 1, true, true, shared},
+    {"BITCOUNT", Command::bitCount, -2, 1, 1, 1, false, false, shared},
+    {"BITPOS", Command::bitPos, -3, 1, 1, 1, false, false, shared},
+    {"BITOP", Command::bitOp, -4, 2, -1, 1, true, true, shared},
+    {"BITFIELD", Command::bitField, -2, 1, 1, 1, true, true, shared},
+    {"MGET", Command::mget, -2, 1, -1, 1, false, false, none},
+    {"SETNX", Command::setnx, 3, 1, 1, 1, true, true, shared},
+    {"SETRANGE", Command::setRange, 4, 1, 1, 1, true, true, shared},
+    {"STRLEN", Command::strlen, 2, 1, 1, 1, false, false, none},
+    {"MSET", Command::mset, -3, 1, -1, 2, true, true, shared},
+    {"MSETNX", Command::msetnx, -3, 1, -1, 2, true, true, shared},
+    {"INCR", Command::incr, 2, 1, 1, 1, true, true, shared},
+    {"INCRBY", Command::incrBy, 3, 1, 1, 1, true, true, shared},
+    {"DECR", Command::decr, 2, 1, 1, 1, true, true, shared},
+    {"DECRBY", Command::decrBy, 3, 1, 1, 1, true, true, shared},
+    {"APPEND", Command::append, 3, 1, 1, 1, true, true, shared},
+    {"HDEL", Command::hdel, -3, 1, 1, 1, true, false, shared},
+    {"HEXISTS", Command::hexists, 3, 1, 1, 1, false, false, shared},
+    {"HGET", Command::hget, 3, 1, 1, 1, false, false, shared},
+    {"HGETALL", Command::hgetAll, 2, 1, 1, 1, false, false, shared},
+    {"HINCRBY", Command::hincrBy, 4, 1, 1, 1, true, true, shared},
+    {"HKEYS", Command::hkeys, 2, 1, 1, 1, false, false, shared},
+    {"HLEN", Command::hlen, 2, 1, 1, 1, false, false, shared},
+    {"HSCAN", Command::hscan, -3, 1, 1, 1, false, false, shared},
+    {"HSET", Command::hset, -4, 1, 1, 1, true, true, shared},
+    {"HVALS", Command::hvals, 2, 1, 1, 1, false, false, shared},
+    {"LINDEX", Command::lindex, 3, 1, 1, 1, false, false, shared},
+    {"LLEN", Command::llen, 2, 1, 1, 1, false, false, shared},
+    {"LPOP", Command::lpop, 2, 1, 1, 1, true, false, shared},
+    {"LPUSH", Command::lpush, -3, 1, 1, 1, true, true, shared},
+    {"LPUSHX", Command::lpushx, -3, 1, 1, 1, true, true, shared},
+    {"LINSERT", Command::linsert, 5, 1, 1, 1, true, true, shared},
+    {"LRANGE", Command::lrange, 4, 1, 1, 1, false, false, shared},
+    {"LREM", Command::lrem, 4, 1, 1, 1, true, false, shared},
+    {"LSET", Command::lset, 4, 1, 1, 1, true, true, shared},
+    {"LTRIM", Command::ltrim, 4, 1, 1, 1, true, false, shared},
+    {"RPOP", Command::rpop, 2, 1, 1, 1, true, false, shared},
+    {"RPUSH", Command::rpush, -3, 1, 1, 1, true, true, shared},
+    {"SADD", Command::sadd, -3, 1, 1, 1, true, true, shared},
+    {"SCARD", Command::scard, 2, 1, 1, 1, false, false, shared},
+    {"SDIFF", Command::sdiff, -2, 1, -1, 1, false, false, shared},
+    {"SINTER", Command::sinter, -2, 1, -1, 1, false, false, shared},
+    {"SINTERCARD", Command::sinterCard, -3, 2, -1, 1, false, false, shared},
+    {"SISMEMBER", Command::sismember, 3, 1, 1, 1, false, false, shared},
+    {"SMEMBERS", Command::smembers, 2, 1, 1, 1, false, false, shared},
+    {"SREM", Command::srem, -3, 1, 1, 1, true, false, shared},
+    {"SSCAN", Command::sscan, -3, 1, 1, 1, false, false, shared},
+    {"SUNION", Command::sunion, -2, 1, -1, 1, false, false, shared},
+    {"ZADD", Command::zadd, -4, 1, 1, 1, true, true, shared},
+    {"ZCOUNT", Command::zcount, 4, 1, 1, 1, false, false, shared},
+    {"ZINCRBY", Command::zincrBy, 4, 1, 1, 1, true, true, shared},
+    {"ZRANGE", Command::zrange, -4, 1, 1, 1, false, false, shared},
+    {"ZRANGEBYSCORE", Command::zrangeByScore, -4, 1, 1, 1, false, false, shared},
+    {"ZRANK", Command::zrank, 3, 1, 1, 1, false, false, shared},
+    {"ZREM", Command::zrem, -3, 1, 1, 1, true, false, shared},
+    {"ZSCORE", Command::zscore, 3, 1, 1, 1, false, false, shared},
+    {"PFADD", Command::pfAdd, -2, 1, 1, 1, true, true, shared},
+    {"PFCOUNT", Command::pfCount, -2, 1, -1, 1, false, false, shared},
+    {"PFMERGE", Command::pfMerge, -2, 1, -1, 1, true, true, shared},
+    {"BF.RESERVE", Command::bfReserve, -4, 1, 1, 1, true, true, shared},
+    {"BF.ADD", Command::bfAdd, 3, 1, 1, 1, true, true, shared},
+    {"BF.MADD", Command::bfMadd, -3, 1, 1, 1, true, true, shared},
+    {"BF.EXISTS", Command::bfExists, 3, 1, 1, 1, false, false, shared},
+    {"BF.MEXISTS", Command::bfMexists, -3, 1, 1, 1, false, false, shared},
+    {"CMS.INITBYDIM", Command::cmsInitByDim, 4, 1, 1, 1, true, true, shared},
+    {"CMS.INITBYPROB", Command::cmsInitByProb, 4, 1, 1, 1, true, true, shared},
+    {"CMS.INCRBY", Command::cmsIncrBy, -4, 1, 1, 1, true, false, shared},
+    {"CMS.QUERY", Command::cmsQuery, -3, 1, 1, 1, false, false, shared},
+    {"TOPK.RESERVE", Command::topkReserve, -3, 1, 1, 1, true, true, shared},
+    {"TOPK.ADD", Command::topkAdd, -3, 1, 1, 1, true, true, shared},
+    {"TOPK.LIST", Command::topkList, -2, 1, 1, 1, false, false, shared},
+}};
+static_assert([] {
+    for (unsigned char i{}; i < commandCount; ++i)
+        if (std::to_underlying(specifications[i].command) != i) return false;
+
+    return true;
+}());
+
+static constexpr auto toUpper(const char character) noexcept -> char {
+    return character >= 'a' && character <= 'z' ? static_cast<char>(character - 'a' + 'A') : character;
+}
+
+static constexpr auto hash(const std::string_view name, const unsigned int seed) noexcept -> unsigned int {
+    unsigned int value{seed};
+    for (const char character : name) value = (value ^ static_cast<unsigned char>(toUpper(character))) * 16777619U;
+
+    return value;
+}
+
+static constexpr unsigned int slotBits{10};
+
+static constexpr unsigned int seed{[] {
+    for (unsigned int seed{2166136261U};; ++seed) {
+        std::array<bool, 1U << slotBits> isUsed{};
+        if (std::ranges::all_of(specifications, [&isUsed, seed](const CommandSpecification &specification) {
+                return !std::exchange(isUsed[hash(specification.name, seed) >> (32 - slotBits)], true);
+            }))
+            return seed;
+    }
+}()};
+
+static constexpr std::array slots{[] {
+    std::array<unsigned char, 1U << slotBits> slots;
+    slots.fill(commandCount);
+    for (unsigned char i{}; i < commandCount; ++i) slots[hash(specifications[i].name, seed) >> (32 - slotBits)] = i;
+
+    return slots;
+}()};
+
+auto toCommand(const std::string_view name) noexcept -> std::optional<Command> {
+    const unsigned char position{slots[hash(name, seed) >> (32 - slotBits)]};
+    if (position == commandCount || !std::ranges::equal(name, specifications[position].name, {}, toUpper))
+        return std::nullopt;
+
+    return specifications[position].command;
+}
+
+auto getSpecification(const Command command) noexcept -> const CommandSpecification & {
+    return specifications[std::to_underlying(command)];
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
 enum class Command : unsigned char {
     select,
     del,
@@ -8,11 +13,24 @@ enum class Command : unsigned char {
     rename,
     renamenx,
     type,
+    scan,
+    range,
+    expire,
+    expireAt,
+    pexpire,
+    pexpireAt,
+    persist,
+    pttl,
+    ttl,
     set,
     get,
     getRange,
     getBit,
     setBit,
+    bitCount,
+    bitPos,
+    bitOp,
+    bitField,
     mget,
     setnx,
     setRange,
@@ -31,11 +49,94 @@ enum class Command : unsigned char {
     hincrBy,
     hkeys,
     hlen,
+    hscan,
     hset,
     hvals,
     lindex,
     llen,
     lpop,
     lpush,
-    lpushx
+    lpushx,
+    linsert,
+    lrange,
+    lrem,
+    lset,
+    ltrim,
+    rpop,
+    rpush,
+    sadd,
+    scard,
+    sdiff,
+    sinter,
+    sinterCard,
+    sismember,
+    smembers,
+    srem,
+    sscan,
+    sunion,
+    zadd,
+    zcount,
+    zincrBy,
+    zrange,
+    zrangeByScore,
+    zrank,
+    zrem,
+    zscore,
+    pfAdd,
+    pfCount,
+    pfMerge,
+    bfReserve,
+    bfAdd,
+    bfMadd,
+    bfExists,
+    bfMexists,
+    cmsInitByDim,
+    cmsInitByProb,
+    cmsIncrBy,
+    cmsQuery,
+    topkReserve,
+    topkAdd,
+    topkList
+};
+
+inline constexpr unsigned char commandCount{std::to_underlying(Command::topkList) + 1};
+
+struct CommandSpecification {
+    enum class Lock : unsigned char { none, shared, exclusive };
+
+    [[nodiscard]] constexpr auto isArityValid(const unsigned long argumentCount) const noexcept -> bool {
+        const unsigned long count{argumentCount + 1};
+
+        return this->arity > 0 ? count == static_cast<unsigned long>(this->arity)
+                               : count >= static_cast<unsigned long>(-this->arity);
+    }
+
+    [[nodiscard]] constexpr auto isSingleKey() const noexcept -> bool {
+        return this->firstKey != 0 && this->firstKey == this->lastKey;
+    }
+
+    template <typename Function>
+    constexpr auto forEachKey(const std::span<const std::string_view> arguments, Function function) const -> void {
+        if (this->firstKey == 0) return;
+
+        const unsigned long lastKey{this->lastKey < 0
+                                        ? arguments.size() + 1 - static_cast<unsigned long>(-this->lastKey)
+                                        : static_cast<unsigned long>(this->lastKey)};
+        for (unsigned long position{this->firstKey}; position <= lastKey && position <= arguments.size();
+             position += this->keyStep)
+            function(arguments[position - 1]);
+    }
+
+    std::string_view name;
+    Command command;
+    signed char arity;
+    unsigned char firstKey;
+    signed char lastKey;
+    unsigned char keyStep;
+    bool isWrite, isDenyOom;
+    Lock lock;
 };
+
+[[nodiscard]] auto toCommand(std::string_view name) noexcept -> std::optional<Command>;
+
+[[nodiscard]] auto getSpecification(Command command) noexcept -> const CommandSpecification &;
@@ -0,0 +1,48 @@
+#include "Frame.hpp"
+
+#include <cstring>
+
+auto Frame::decode(std::span<const std::byte> &data) noexcept -> std::optional<std::span<const std::byte>> {
+    unsigned long size;
+    if (data.size() < sizeof(size)) return std::nullopt;
+    std::memcpy(&size, data.data(), sizeof(size));
+
+    if (size > maxSize || data.size() - sizeof(size) < size) return std::nullopt;
+
+    const std::span payload{data.subspan(sizeof(size), size)};
+    data = data.subspan(sizeof(size) + size);
+
+    return payload;
+}
+
+auto Frame::isOversized(const std::span<const std::byte> data) noexcept -> bool {
+    unsigned long size;
+    if (data.size() < sizeof(size)) return false;
+    std::memcpy(&size, data.data(), sizeof(size));
+
+    return size > maxSize;
+}
+
+auto Frame::encode(std::vector<std::byte> &buffer, const std::span<const std::byte> payload) -> void {
+    const unsigned long size{payload.size()};
+    buffer.resize(buffer.size() + sizeof(size));
+    std::memcpy(buffer.data() + buffer.size() - sizeof(size), &size, sizeof(size));
+
+    buffer.insert(buffer.cend(), payload.begin(), payload.end());
+}
+
+auto Frame::decodeArguments(std::span<const std::byte> data) -> std::optional<std::vector<std::string_view>> {
+    std::vector<std::string_view> arguments;
+    while (!data.empty()) {
+        const std::optional argument{decode(data)};
+        if (!argument.has_value()) return std::nullopt;
+
+        arguments.emplace_back(reinterpret_cast<const char *>(argument->data()), argument->size());
+    }
+
+    return arguments;
+}
+
+auto Frame::encodeArguments(std::vector<std::byte> &buffer, const std::span<const std::string_view> arguments) -> void {
+    for (const std::string_view argument : arguments) encode(buffer, std::as_bytes(std::span{argument}));
+}
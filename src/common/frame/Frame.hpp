@@ -0,0 +1,24 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class Frame {
+public:
+    [[nodiscard]] static auto decode(std::span<const std::byte> &data) noexcept
+        -> std::optional<std::span<const std::byte>>;
+
+    [[nodiscard]] static auto isOversized(std::span<const std::byte> data) noexcept -> bool;
+
+    static auto encode(std::vector<std::byte> &buffer, std::span<const std::byte> payload) -> void;
+
+    [[nodiscard]] static auto decodeArguments(std::span<const std::byte> data)
+        -> std::optional<std::vector<std::string_view>>;
+
+    static auto encodeArguments(std::vector<std::byte> &buffer, std::span<const std::string_view> arguments) -> void;
+
+private:
+    static constexpr unsigned long maxSize{512UL << 20};
+};
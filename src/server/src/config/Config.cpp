@@ -0,0 +1,142 @@
+#include "Config.hpp"
+
+#include "../../../common/log/Exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+
+auto Config::parse(std::span<const char *const> arguments, const std::source_location sourceLocation) -> void {
+    while (!arguments.empty()) {
+        const std::string_view name{arguments.front()};
+        if (arguments.size() < 2) {
+            throw Exception{
+                Log{Log::Level::fatal, "missing value for option " + std::string{name}, sourceLocation}
+            };
+        }
+        const std::string_view value{arguments[1]};
+        arguments = arguments.subspan(2);
+
+        if (name == "--shared-nothing") sharedNothing = parseBool(value);
+        else if (name == "--hash-max-listpack-entries") hashMaxListpackEntries = parseUnsigned(value);
+        else if (name == "--hash-max-listpack-value") hashMaxListpackValue = parseUnsigned(value);
+        else if (name == "--list-max-listpack-entries") listMaxListpackEntries = parseUnsigned(value);
+        else if (name == "--list-max-listpack-value") listMaxListpackValue = parseUnsigned(value);
+        else if (name == "--set-max-intset-entries") setMaxIntsetEntries = parseUnsigned(value);
+        else if (name == "--set-max-listpack-entries") setMaxListpackEntries = parseUnsigned(value);
+        else if (name == "--set-max-listpack-value") setMaxListpackValue = parseUnsigned(value);
+        else if (name == "--maxmemory") maxmemory = parseMemory(value);
+        else if (name == "--maxmemory-policy") maxmemoryPolicy = parseMaxmemoryPolicy(value);
+        else if (name == "--maxmemory-samples") maxmemorySamples = std::max(parseUnsigned(value), 1UL);
+        else if (name == "--hll-sparse-max-bytes") hllSparseMaxBytes = parseUnsigned(value);
+        else {
+            throw Exception{
+                Log{Log::Level::fatal, "unknown option " + std::string{name}, sourceLocation}
+            };
+        }
+    }
+}
+
+auto Config::isSharedNothing() noexcept -> bool { return sharedNothing; }
+
+auto Config::getHashMaxListpackEntries() noexcept -> unsigned long { return hashMaxListpackEntries; }
+
+auto Config::getHashMaxListpackValue() noexcept -> unsigned long { return hashMaxListpackValue; }
+
+auto Config::getListMaxListpackEntries() noexcept -> unsigned long { return listMaxListpackEntries; }
+
+auto Config::getListMaxListpackValue() noexcept -> unsigned long { return listMaxListpackValue; }
+
+auto Config::getSetMaxIntsetEntries() noexcept -> unsigned long { return setMaxIntsetEntries; }
+
+auto Config::getSetMaxListpackEntries() noexcept -> unsigned long { return setMaxListpackEntries; }
+
+auto Config::getSetMaxListpackValue() noexcept -> unsigned long { return setMaxListpackValue; }
+
+auto Config::getMaxmemory() noexcept -> unsigned long { return maxmemory; }
+
+auto Config::getMaxmemoryPolicy() noexcept -> MaxmemoryPolicy { return maxmemoryPolicy; }
+
+auto Config::getMaxmemorySamples() noexcept -> unsigned long { return maxmemorySamples; }
+
+auto Config::getHllSparseMaxBytes() noexcept -> unsigned long { return hllSparseMaxBytes; }
+
+auto Config::getMaxAllocation() noexcept -> unsigned long {
+    return maxmemory != 0 ? std::min(maxAllocation, maxmemory) : maxAllocation;
+}
+
+auto Config::parseBool(const std::string_view value, const std::source_location sourceLocation) -> bool {
+    if (value == "yes") return true;
+    if (value == "no") return false;
+
+    throw Exception{
+        Log{Log::Level::fatal, "invalid value " + std::string{value} + ", expected yes or no", sourceLocation}
+    };
+}
+
+auto Config::parseUnsigned(const std::string_view value, const std::source_location sourceLocation) -> unsigned long {
+    unsigned long result{};
+    if (const auto [end, error]{std::from_chars(value.data(), value.data() + value.size(), result)};
+        error != std::errc{} || end != value.data() + value.size()) {
+        throw Exception{
+            Log{Log::Level::fatal, "invalid value " + std::string{value} + ", expected an unsigned integer",
+                sourceLocation}
+        };
+    }
+
+    return result;
+}
+
+auto Config::parseMemory(std::string_view value, const std::source_location sourceLocation) -> unsigned long {
+    static constexpr std::array<std::pair<std::string_view, unsigned long>, 6> units{
+        {{"kb", 1UL << 10},
+         {"mb", 1UL << 20},
+         {"gb", 1UL << 30},
+         {"k", 1000},
+         {"m", 1000 * 1000},
+         {"g", 1000 * 1000 * 1000}}
+    };
+
+    unsigned long multiple{1};
+    for (const auto &[unit, unitMultiple] : units) {
+        if (value.size() > unit.size() &&
+            std::ranges::equal(value.substr(value.size() - unit.size()), unit,
+                               [](const char left, const char right) { return std::tolower(left) == right; })) {
+            value.remove_suffix(unit.size());
+            multiple = unitMultiple;
+
+            break;
+        }
+    }
+
+    return parseUnsigned(value, sourceLocation) * multiple;
+}
+
+auto Config::parseMaxmemoryPolicy(const std::string_view value, const std::source_location sourceLocation)
+    -> MaxmemoryPolicy {
+    static constexpr std::array<std::pair<std::string_view, MaxmemoryPolicy>, 8> policies{
+        {{"noeviction", MaxmemoryPolicy::noeviction},
+         {"allkeys-lru", MaxmemoryPolicy::allkeysLru},
+         {"allkeys-lfu", MaxmemoryPolicy::allkeysLfu},
+         {"allkeys-random", MaxmemoryPolicy::allkeysRandom},
+         {"volatile-lru", MaxmemoryPolicy::volatileLru},
+         {"volatile-lfu", MaxmemoryPolicy::volatileLfu},
+         {"volatile-random", MaxmemoryPolicy::volatileRandom},
+         {"volatile-ttl", MaxmemoryPolicy::volatileTtl}}
+    };
+
+    for (const auto &[name, policy] : policies)
+        if (name == value) return policy;
+
+    throw Exception{
+        Log{Log::Level::fatal, "invalid value " + std::string{value} + ", expected a maxmemory policy", sourceLocation}
+    };
+}
+
+constinit bool Config::sharedNothing{};
+constinit unsigned long Config::hashMaxListpackEntries{128}, Config::hashMaxListpackValue{64},
+    Config::listMaxListpackEntries{128}, Config::listMaxListpackValue{64}, Config::setMaxIntsetEntries{512},
+    Config::setMaxListpackEntries{128}, Config::setMaxListpackValue{64}, Config::maxmemory{},
+    Config::maxmemorySamples{5}, Config::hllSparseMaxBytes{3000};
+constinit Config::MaxmemoryPolicy Config::maxmemoryPolicy{MaxmemoryPolicy::noeviction};
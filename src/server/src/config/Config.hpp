@@ -0,0 +1,72 @@
+#pragma once
+
+#include <source_location>
+#include <span>
+#include <string_view>
+
+class Config {
+public:
+    enum class MaxmemoryPolicy : unsigned char {
+        noeviction,
+        allkeysLru,
+        allkeysLfu,
+        allkeysRandom,
+        volatileLru,
+        volatileLfu,
+        volatileRandom,
+        volatileTtl
+    };
+
+    static auto parse(std::span<const char *const> arguments,
+                      std::source_location sourceLocation = std::source_location::current()) -> void;
+
+    [[nodiscard]] static auto isSharedNothing() noexcept -> bool;
+
+    [[nodiscard]] static auto getHashMaxListpackEntries() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getHashMaxListpackValue() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getListMaxListpackEntries() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getListMaxListpackValue() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getSetMaxIntsetEntries() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getSetMaxListpackEntries() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getSetMaxListpackValue() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getMaxmemory() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getMaxmemoryPolicy() noexcept -> MaxmemoryPolicy;
+
+    [[nodiscard]] static auto getMaxmemorySamples() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getHllSparseMaxBytes() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getMaxAllocation() noexcept -> unsigned long;
+
+private:
+    [[nodiscard]] static auto parseBool(std::string_view value,
+                                        std::source_location sourceLocation = std::source_location::current()) -> bool;
+
+    [[nodiscard]] static auto parseUnsigned(std::string_view value,
+                                            std::source_location sourceLocation = std::source_location::current())
+        -> unsigned long;
+
+    [[nodiscard]] static auto parseMemory(std::string_view value,
+                                          std::source_location sourceLocation = std::source_location::current())
+        -> unsigned long;
+
+    [[nodiscard]] static auto
+        parseMaxmemoryPolicy(std::string_view value,
+                             std::source_location sourceLocation = std::source_location::current()) -> MaxmemoryPolicy;
+
+    static constexpr unsigned long maxAllocation{512UL << 20};
+
+    static constinit bool sharedNothing;
+    static constinit unsigned long hashMaxListpackEntries, hashMaxListpackValue, listMaxListpackEntries,
+        listMaxListpackValue, setMaxIntsetEntries, setMaxListpackEntries, setMaxListpackValue, maxmemory,
+        maxmemorySamples, hllSparseMaxBytes;
+    static constinit MaxmemoryPolicy maxmemoryPolicy;
+};
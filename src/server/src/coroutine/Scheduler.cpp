@@ -1,8 +1,12 @@
 #include "Scheduler.hpp"
 
+#include "../../../common/frame/Frame.hpp"
 #include "../../../common/log/Exception.hpp"
+#include "../config/Config.hpp"
 #include "../database/Database.hpp"
+#include "../database/Epoch.hpp"
 #include "../fileDescriptor/Client.hpp"
+#include "../protocol/Resp.hpp"
 #include "../ring/Completion.hpp"
 #include "../ring/Ring.hpp"
 
@@ -42,7 +46,7 @@ Scheduler::Scheduler(const int sharedFileDescriptor, const unsigned int cpuCode,
 
         return ring;
     }()},
-    main{main} {
+    id{cpuCode}, main{main} {
     this->ring->registerSelfFileDescriptor();
     this->ring->registerCpu(cpuCode);
     this->ring->registerSparseFileDescriptor(Ring::getFileDescriptorLimit());
@@ -53,15 +57,20 @@ Scheduler::Scheduler(const int sharedFileDescriptor, const unsigned int cpuCode,
     this->ring->allocateFileDescriptorRange(fileDescriptors.size(),
                                             Ring::getFileDescriptorLimit() - fileDescriptors.size());
     this->ring->updateFileDescriptors(0, fileDescriptors);
+
+    ringFileDescriptors[this->id].store(this->ring->getFileDescriptor(), std::memory_order::release);
+    if (this->main) static_cast<void>(getDatabaseManager());
 }
 
 Scheduler::~Scheduler() {
+    ringFileDescriptors[this->id].store(-1, std::memory_order::release);
+
     for (const auto &client : this->clients | std::views::values)
         this->submit(std::make_shared<Task>(this->close(client.getFileDescriptor())));
     this->submit(std::make_shared<Task>(this->close(this->timer.getFileDescriptor())));
     this->submit(std::make_shared<Task>(this->close(this->server.getFileDescriptor())));
     this->submit(std::make_shared<Task>(this->close(this->logger->getFileDescriptor())));
-    if (this->main) this->submit(std::make_shared<Task>(this->close(databaseManager.getFileDescriptor())));
+    if (this->main) this->submit(std::make_shared<Task>(this->close(getDatabaseManager().getFileDescriptor())));
 
     this->ring->wait(this->main ? 4 : 3 + this->clients.size());
     this->frame();
@@ -81,15 +90,72 @@ auto Scheduler::run() -> void {
     }
 }
 
+auto Scheduler::isMessage(const unsigned long userData) noexcept -> bool { return userData & 1; }
+
+auto Scheduler::getOwner(std::span<const std::byte> requests) const noexcept -> unsigned int {
+    if (!Config::isSharedNothing()) return this->id;
+
+    std::optional<unsigned int> owner;
+    while (const std::optional request{Frame::decode(requests)}) {
+        const std::string_view key{DatabaseManager::getKey(*request)};
+        if (key.empty()) return this->id;
+
+        const auto requestOwner{static_cast<unsigned int>(Database::getShardIndex(key) % ringFileDescriptors.size())};
+        if (owner.has_value() && *owner != requestOwner) return this->id;
+        owner = requestOwner;
+    }
+    if (!owner.has_value() || ringFileDescriptors[*owner].load(std::memory_order::acquire) == -1) return this->id;
+
+    return *owner;
+}
+
+auto Scheduler::execute(std::span<const std::byte> requests) -> std::vector<std::byte> {
+    std::vector<std::byte> responses;
+    while (const std::optional request{Frame::decode(requests)})
+        Frame::encode(responses, getDatabaseManager().query(*request));
+
+    return responses;
+}
+
+auto Scheduler::getDatabaseManager() -> DatabaseManager & {
+    static DatabaseManager databaseManager{3};
+
+    return databaseManager;
+}
+
 auto Scheduler::frame() -> void {
     const int completionCount{this->ring->poll([this](const Completion &completion) {
-        if (completion.outcome.result != 0 || !(completion.outcome.flags & IORING_CQE_F_NOTIF)) {
+        if (isMessage(completion.userData))
+            this->handle(std::unique_ptr<Message>{reinterpret_cast<Message *>(completion.userData & ~1UL)});
+        else if (completion.outcome.result != 0 || !(completion.outcome.flags & IORING_CQE_F_NOTIF)) {
             this->currentUserData = completion.userData;
             const std::shared_ptr task{this->tasks.at(this->currentUserData)};
             task->resume(completion.outcome);
         }
     })};
     this->ring->advance(this->ringBuffer.getHandle(), completionCount, this->ringBuffer.getAddedBufferCount());
+
+    Epoch::reclaim();
+}
+
+auto Scheduler::handle(std::unique_ptr<Message> &&message) -> void {
+    if (message->type == Message::Type::request) {
+        message->data = execute(message->data);
+        message->type = Message::Type::reply;
+
+        if (const unsigned int source{message->source}; source != this->id) {
+            this->submit(std::make_shared<Task>(this->forward(source, std::move(message))));
+
+            return;
+        }
+    }
+
+    if (const auto result{this->forwardings.find(message->fileDescriptor)};
+        result != this->forwardings.cend() && --result->second.count == 0)
+        this->forwardings.erase(result);
+
+    if (const auto result{this->clients.find(message->fileDescriptor)}; result != this->clients.cend())
+        this->submit(std::make_shared<Task>(this->send(result->second, std::move(message->data))));
 }
 
 auto Scheduler::submit(std::shared_ptr<Task> &&task) -> void {
@@ -138,14 +204,22 @@ auto Scheduler::timing(const std::source_location sourceLocation) -> Task {
         };
     }
 
-    if (this->main && databaseManager.isWritable())
-        this->submit(std::make_shared<Task>(databaseManager.isTruncatable() ? this->truncate() : this->writeData()));
+    if (this->main) {
+        Entry::tick();
+        getDatabaseManager().activeExpire();
+
+        if (getDatabaseManager().isWritable())
+            this->submit(
+                std::make_shared<Task>(getDatabaseManager().isTruncatable() ? this->truncate() : this->writeData()));
+    }
 
     this->eraseCurrentTask();
 }
 
 auto Scheduler::receive(const Client &client, const std::source_location sourceLocation) -> Task {
     std::vector<std::byte> buffer;
+    std::optional<bool> isResp;
+    Resp resp;
 
     while (true) {
         if (const auto [result, flags]{co_await client.receive(this->ringBuffer.getId())};
@@ -153,12 +227,49 @@ auto Scheduler::receive(const Client &client, const std::source_location sourceL
             const std::span receivedData{this->ringBuffer.readFromBuffer(flags >> IORING_CQE_BUFFER_SHIFT, result)};
             buffer.insert(buffer.cend(), receivedData.cbegin(), receivedData.cend());
 
-            if (!(flags & IORING_CQE_F_SOCK_NONEMPTY)) {
-                std::vector response{databaseManager.query(buffer)};
-                buffer.clear();
+            if (!isResp.has_value()) isResp = Resp::detect(buffer);
+            if (!isResp.has_value()) continue;
+
+            std::span<const std::byte> remaining{buffer};
+            if (*isResp) {
+                std::optional response{resp.process(remaining, getDatabaseManager())};
+                if (!response.has_value()) {
+                    this->logger->push(Log{Log::Level::warn, "protocol error", sourceLocation});
+                    this->submit(std::make_shared<Task>(this->close(client.getFileDescriptor())));
+
+                    break;
+                }
+                if (!response->empty()) this->submit(std::make_shared<Task>(this->send(client, std::move(*response))));
+
+                buffer.erase(buffer.cbegin(), buffer.cend() - static_cast<long>(remaining.size()));
+
+                continue;
+            }
+
+            while (Frame::decode(remaining).has_value()) {}
+            if (Frame::isOversized(remaining)) {
+                this->logger->push(Log{Log::Level::warn, "request too large", sourceLocation});
+                this->submit(std::make_shared<Task>(this->close(client.getFileDescriptor())));
 
-                this->submit(std::make_shared<Task>(this->send(client, std::move(response))));
+                break;
             }
+
+            const std::span requests{std::span<const std::byte>{buffer}.first(buffer.size() - remaining.size())};
+            if (requests.empty()) continue;
+
+            unsigned int owner{this->getOwner(requests)};
+            if (const auto forwarding{this->forwardings.find(client.getFileDescriptor())};
+                forwarding != this->forwardings.cend())
+                owner = forwarding->second.owner;
+
+            if (owner != this->id) {
+                ++this->forwardings.try_emplace(client.getFileDescriptor(), owner, 0).first->second.count;
+                this->submit(std::make_shared<Task>(this->forward(
+                    owner, std::make_unique<Message>(std::vector<std::byte>{requests.begin(), requests.end()},
+                                                     client.getFileDescriptor(), this->id, Message::Type::request))));
+            } else this->submit(std::make_shared<Task>(this->send(client, execute(requests))));
+
+            buffer.erase(buffer.cbegin(), buffer.cbegin() + static_cast<long>(requests.size()));
         } else {
             this->logger->push(Log{
                 Log::Level::warn, result == 0 ? "connection closed" : std::strerror(std::abs(result)), sourceLocation});
@@ -185,8 +296,34 @@ auto Scheduler::send(const Client &client, std::vector<std::byte> &&data, const
     this->eraseCurrentTask();
 }
 
+auto Scheduler::forward(const unsigned int target, std::unique_ptr<Message> &&message,
+                        const std::source_location sourceLocation) -> Task {
+    Message *const pointer{message.release()};
+
+    Awaiter awaiter;
+    awaiter.setSubmission(Submission{
+        ringFileDescriptors[target].load(std::memory_order::acquire),
+        0,
+        0,
+        Submission::MessageRing{0, reinterpret_cast<unsigned long>(pointer) | 1, 0},
+    });
+
+    if (const auto [result, flags]{co_await awaiter}; result < 0) {
+        this->logger->push(Log{Log::Level::warn, std::strerror(std::abs(result)), sourceLocation});
+
+        std::unique_ptr<Message> unsent{pointer};
+        if (unsent->type == Message::Type::request) this->handle(std::move(unsent));
+        else if (++unsent->attempt < forwardAttemptLimit &&
+                 ringFileDescriptors[target].load(std::memory_order::acquire) != -1)
+            this->submit(std::make_shared<Task>(this->forward(target, std::move(unsent))));
+        else this->logger->push(Log{Log::Level::error, "reply dropped", sourceLocation});
+    }
+
+    this->eraseCurrentTask();
+}
+
 auto Scheduler::truncate(std::source_location sourceLocation) -> Task {
-    if (const auto [result, flags]{co_await databaseManager.truncate()}; result != 0) {
+    if (const auto [result, flags]{co_await getDatabaseManager().truncate()}; result != 0) {
         throw Exception{
             Log{Log::Level::error, std::strerror(std::abs(result)), sourceLocation}
         };
@@ -197,12 +334,12 @@ auto Scheduler::truncate(std::source_location sourceLocation) -> Task {
 }
 
 auto Scheduler::writeData(std::source_location sourceLocation) -> Task {
-    if (const auto [result, flags]{co_await databaseManager.write()}; result < 0) {
+    if (const auto [result, flags]{co_await getDatabaseManager().write()}; result < 0) {
         throw Exception{
             Log{Log::Level::error, std::strerror(std::abs(result)), sourceLocation}
         };
     }
-    databaseManager.wrote();
+    getDatabaseManager().wrote();
 
     this->eraseCurrentTask();
 }
@@ -212,11 +349,12 @@ auto Scheduler::close(const int fileDescriptor, const std::source_location sourc
     if (fileDescriptor == this->logger->getFileDescriptor()) outcome = co_await this->logger->close();
     else if (fileDescriptor == this->server.getFileDescriptor()) outcome = co_await this->server.close();
     else if (fileDescriptor == this->timer.getFileDescriptor()) outcome = co_await this->timer.close();
-    else if (this->main && fileDescriptor == databaseManager.getFileDescriptor())
-        outcome = co_await databaseManager.close();
+    else if (this->main && fileDescriptor == getDatabaseManager().getFileDescriptor())
+        outcome = co_await getDatabaseManager().close();
     else [[likely]] {
         outcome = co_await this->clients.at(fileDescriptor).close();
         this->clients.erase(fileDescriptor);
+        this->forwardings.erase(fileDescriptor);
     }
 
     if (outcome.result < 0)
@@ -226,4 +364,9 @@ auto Scheduler::close(const int fileDescriptor, const std::source_location sourc
 }
 
 constinit std::atomic_flag Scheduler::switcher{true};
-DatabaseManager Scheduler::databaseManager{3};
+std::vector<std::atomic_int> Scheduler::ringFileDescriptors{[] {
+    std::vector<std::atomic_int> ringFileDescriptors(std::thread::hardware_concurrency());
+    for (auto &ringFileDescriptor : ringFileDescriptors) ringFileDescriptor.store(-1, std::memory_order::relaxed);
+
+    return ringFileDescriptors;
+}()};
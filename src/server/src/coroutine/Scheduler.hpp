@@ -9,6 +9,21 @@
 class Client;
 
 class Scheduler {
+    struct Message {
+        enum class Type : unsigned char { request, reply };
+
+        std::vector<std::byte> data;
+        int fileDescriptor;
+        unsigned int source;
+        Type type;
+        unsigned char attempt{};
+    };
+
+    struct Forwarding {
+        unsigned int owner;
+        unsigned long count;
+    };
+
 public:
     static auto registerSignal(std::source_location sourceLocation = std::source_location::current()) -> void;
 
@@ -29,8 +44,18 @@ public:
     auto run() -> void;
 
 private:
+    [[nodiscard]] static auto isMessage(unsigned long userData) noexcept -> bool;
+
+    [[nodiscard]] auto getOwner(std::span<const std::byte> requests) const noexcept -> unsigned int;
+
+    [[nodiscard]] static auto getDatabaseManager() -> DatabaseManager &;
+
+    [[nodiscard]] static auto execute(std::span<const std::byte> requests) -> std::vector<std::byte>;
+
     auto frame() -> void;
 
+    auto handle(std::unique_ptr<Message> &&message) -> void;
+
     auto submit(std::shared_ptr<Task> &&task) -> void;
 
     auto eraseCurrentTask() -> void;
@@ -47,6 +72,9 @@ private:
     [[nodiscard]] auto send(const Client &client, std::vector<std::byte> &&data,
                             std::source_location sourceLocation = std::source_location::current()) -> Task;
 
+    [[nodiscard]] auto forward(unsigned int target, std::unique_ptr<Message> &&message,
+                               std::source_location sourceLocation = std::source_location::current()) -> Task;
+
     [[nodiscard]] auto truncate(std::source_location sourceLocation = std::source_location::current()) -> Task;
 
     [[nodiscard]] auto writeData(std::source_location sourceLocation = std::source_location::current()) -> Task;
@@ -54,16 +82,20 @@ private:
     [[nodiscard]] auto close(int fileDescriptor, std::source_location sourceLocation = std::source_location::current())
         -> Task;
 
+    static constexpr unsigned char forwardAttemptLimit{3};
+
     static constinit std::atomic_flag switcher;
-    static DatabaseManager databaseManager;
+    static std::vector<std::atomic_int> ringFileDescriptors;
 
     const std::shared_ptr<Ring> ring;
     const std::shared_ptr<Logger> logger{std::make_shared<Logger>(0)};
     const Server server{1};
     Timer timer{2};
     std::unordered_map<int, Client> clients;
+    std::unordered_map<int, Forwarding> forwardings;
     RingBuffer ringBuffer{this->ring, std::bit_ceil(2048 / std::thread::hardware_concurrency()), 1024, 0};
     std::unordered_map<unsigned long, std::shared_ptr<Task>> tasks;
     unsigned long currentUserData{};
+    unsigned int id;
     bool main;
 };
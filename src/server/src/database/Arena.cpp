@@ -0,0 +1,92 @@
+#include "Arena.hpp"
+
+#include "Epoch.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <utility>
+
+Arena::~Arena() {
+    for (Shard &shard : this->shards) {
+        for (const auto &[pointer, size, destructor, epoch] : shard.retireds) {
+            destructor(pointer);
+            if (getSizeClass(size) >= sizeClassCount) ::operator delete(pointer, size);
+        }
+    }
+}
+
+auto Arena::allocate(const unsigned long size) -> void * {
+    const unsigned long sizeClass{getSizeClass(size)};
+    if (sizeClass >= sizeClassCount) return ::operator new(size);
+
+    Shard &shard{this->getShard()};
+
+    const std::lock_guard lockGuard{shard.lock};
+
+    if (void *&freeList{shard.freeLists[sizeClass]}; freeList != nullptr)
+        return std::exchange(freeList, *static_cast<void **>(freeList));
+
+    const unsigned long alignedSize{(sizeClass + 1) * alignment};
+    if (shard.cursor == nullptr || static_cast<unsigned long>(shard.end - shard.cursor) < alignedSize) {
+        shard.chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(chunkSize));
+        shard.cursor = shard.chunks.back().get();
+        shard.end = shard.cursor + chunkSize;
+    }
+
+    return std::exchange(shard.cursor, shard.cursor + alignedSize);
+}
+
+auto Arena::deallocate(void *const pointer, const unsigned long size) noexcept -> void {
+    if (getSizeClass(size) >= sizeClassCount) {
+        ::operator delete(pointer, size);
+
+        return;
+    }
+
+    Shard &shard{this->getShard()};
+
+    const std::lock_guard lockGuard{shard.lock};
+
+    this->free(shard, pointer, size);
+}
+
+auto Arena::retire(void *const pointer, const unsigned long size, void (*const destructor)(void *) noexcept)
+    -> void {
+    Shard &shard{this->getShard()};
+
+    const std::lock_guard lockGuard{shard.lock};
+
+    shard.retireds.emplace_back(pointer, size, destructor, Epoch::getEpoch());
+
+    if (shard.retireds.size() % collectInterval == 0) {
+        Epoch::tryAdvance();
+        this->collect(shard);
+    }
+}
+
+auto Arena::getSizeClass(const unsigned long size) noexcept -> unsigned long { return (size - 1) / alignment; }
+
+auto Arena::getShard() noexcept -> Shard & {
+    thread_local const unsigned long shardIndex{std::hash<std::thread::id>{}(std::this_thread::get_id())};
+
+    return this->shards[shardIndex % this->shards.size()];
+}
+
+auto Arena::free(Shard &shard, void *const pointer, const unsigned long size) noexcept -> void {
+    if (const unsigned long sizeClass{getSizeClass(size)}; sizeClass < sizeClassCount) {
+        *static_cast<void **>(pointer) = shard.freeLists[sizeClass];
+        shard.freeLists[sizeClass] = pointer;
+    } else ::operator delete(pointer, size);
+}
+
+auto Arena::collect(Shard &shard) noexcept -> void {
+    std::erase_if(shard.retireds, [this, &shard](const Retired &retired) noexcept {
+        if (!Epoch::isReclaimable(retired.epoch)) return false;
+
+        retired.destructor(retired.pointer);
+        this->free(shard, retired.pointer, retired.size);
+
+        return true;
+    });
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Arena {
+    static constexpr unsigned long alignment{16}, sizeClassCount{64}, chunkSize{1 << 20}, collectInterval{64};
+
+    struct Retired {
+        void *pointer;
+        unsigned long size;
+        void (*destructor)(void *) noexcept;
+        unsigned long epoch;
+    };
+
+    struct Shard {
+        std::mutex lock;
+        std::vector<std::unique_ptr<std::byte[]>> chunks;
+        std::byte *cursor{}, *end{};
+        std::array<void *, sizeClassCount> freeLists{};
+        std::vector<Retired> retireds;
+    };
+
+public:
+    Arena() = default;
+
+    Arena(const Arena &) = delete;
+
+    Arena(Arena &&) = delete;
+
+    auto operator=(const Arena &) -> Arena & = delete;
+
+    auto operator=(Arena &&) -> Arena & = delete;
+
+    ~Arena();
+
+    [[nodiscard]] auto allocate(unsigned long size) -> void *;
+
+    auto deallocate(void *pointer, unsigned long size) noexcept -> void;
+
+    auto retire(void *pointer, unsigned long size, void (*destructor)(void *) noexcept) -> void;
+
+private:
+    [[nodiscard]] static auto getSizeClass(unsigned long size) noexcept -> unsigned long;
+
+    [[nodiscard]] auto getShard() noexcept -> Shard &;
+
+    auto free(Shard &shard, void *pointer, unsigned long size) noexcept -> void;
+
+    auto collect(Shard &shard) noexcept -> void;
+
+    std::array<Shard, 16> shards;
+};
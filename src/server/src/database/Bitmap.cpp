@@ -0,0 +1,205 @@
+#include "Bitmap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+auto Bitmap::count(const std::string_view bytes) noexcept -> unsigned long {
+#if defined(__x86_64__)
+    if (isAvx2()) return countAvx2(bytes);
+#endif
+
+    return countScalar(bytes);
+}
+
+auto Bitmap::find(const std::string_view bytes, const bool bit) noexcept -> unsigned long {
+#if defined(__x86_64__)
+    if (isAvx2()) return findAvx2(bytes, bit);
+#endif
+
+    return findScalar(bytes, bit);
+}
+
+auto Bitmap::combine(const Operation operation, const std::span<const std::string_view> sources) -> std::string {
+    unsigned long size{};
+    for (const auto source : sources) size = std::max(size, source.size());
+
+    std::string result(size, 0);
+    if (sources.empty()) return result;
+    std::ranges::copy(sources.front(), result.begin());
+
+    const auto apply{[operation](char *const destination, const char *const source, const unsigned long size) {
+#if defined(__x86_64__)
+        if (isAvx2()) return applyAvx2(operation, destination, source, size);
+#endif
+
+        applyScalar(operation, destination, source, size);
+    }};
+
+    if (operation == Operation::bitNot) apply(result.data(), result.data(), result.size());
+    else {
+        for (const auto source : sources.subspan(1)) {
+            apply(result.data(), source.data(), source.size());
+            if (operation == Operation::bitAnd)
+                std::fill(result.begin() + static_cast<long>(source.size()), result.end(), 0);
+        }
+    }
+
+    return result;
+}
+
+auto Bitmap::getField(const std::string_view bytes, const unsigned long offset, const unsigned char width) noexcept
+    -> unsigned long {
+    unsigned long value{};
+    for (unsigned char i{}; i < width; ++i) {
+        const unsigned long position{offset + i}, index{position / 8};
+        if (index < bytes.size() && (static_cast<unsigned char>(bytes[index]) >> position % 8 & 1)) value |= 1UL << i;
+    }
+
+    return value;
+}
+
+auto Bitmap::setField(std::string &bytes, const unsigned long offset, const unsigned char width,
+                      const unsigned long value) -> void {
+    if (const unsigned long size{(offset + width + 7) / 8}; bytes.size() < size) bytes.resize(size);
+
+    for (unsigned char i{}; i < width; ++i) {
+        const unsigned long position{offset + i};
+        char &byte{bytes[position / 8]};
+
+        if (value >> i & 1) byte = static_cast<char>(byte | 1 << position % 8);
+        else byte = static_cast<char>(byte & ~(1 << position % 8));
+    }
+}
+
+auto Bitmap::isAvx2() noexcept -> bool {
+#if defined(__x86_64__)
+    static const bool isSupported{__builtin_cpu_supports("avx2") != 0};
+
+    return isSupported;
+#else
+    return false;
+#endif
+}
+
+auto Bitmap::countScalar(const std::string_view bytes) noexcept -> unsigned long {
+    unsigned long count{}, i{};
+    for (; i + sizeof(unsigned long) <= bytes.size(); i += sizeof(unsigned long)) {
+        unsigned long word;
+        std::memcpy(&word, bytes.data() + i, sizeof(word));
+        count += std::popcount(word);
+    }
+    for (; i < bytes.size(); ++i) count += std::popcount(static_cast<unsigned char>(bytes[i]));
+
+    return count;
+}
+
+auto Bitmap::findScalar(const std::string_view bytes, const bool bit) noexcept -> unsigned long {
+    const unsigned long skippedWord{bit ? 0 : ~0UL};
+
+    unsigned long i{};
+    for (; i + sizeof(unsigned long) <= bytes.size(); i += sizeof(unsigned long)) {
+        unsigned long word;
+        std::memcpy(&word, bytes.data() + i, sizeof(word));
+        if (word != skippedWord) break;
+    }
+    for (; i < bytes.size(); ++i) {
+        const auto byte{static_cast<unsigned char>(bit ? bytes[i] : ~bytes[i])};
+        if (byte != 0) return i * 8 + std::countr_zero(byte);
+    }
+
+    return std::string_view::npos;
+}
+
+auto Bitmap::applyScalar(const Operation operation, char *const destination, const char *const source,
+                         const unsigned long size) noexcept -> void {
+    for (unsigned long i{}; i < size; ++i) {
+        switch (operation) {
+            case Operation::bitAnd:
+                destination[i] = static_cast<char>(destination[i] & source[i]);
+                break;
+            case Operation::bitOr:
+                destination[i] = static_cast<char>(destination[i] | source[i]);
+                break;
+            case Operation::bitXor:
+                destination[i] = static_cast<char>(destination[i] ^ source[i]);
+                break;
+            case Operation::bitNot:
+                destination[i] = static_cast<char>(~source[i]);
+                break;
+        }
+    }
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) auto Bitmap::countAvx2(const std::string_view bytes) noexcept -> unsigned long {
+    const __m256i lookup{_mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2,
+                                          2, 3, 2, 3, 3, 4)},
+        lowMask{_mm256_set1_epi8(0x0f)};
+
+    __m256i total{_mm256_setzero_si256()};
+    unsigned long i{};
+    for (; i + sizeof(__m256i) <= bytes.size(); i += sizeof(__m256i)) {
+        const __m256i block{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes.data() + i))},
+            low{_mm256_and_si256(block, lowMask)}, high{_mm256_and_si256(_mm256_srli_epi16(block, 4), lowMask)},
+            counts{_mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high))};
+
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+
+    return static_cast<unsigned long>(_mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+                                      _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3)) +
+           countScalar(bytes.substr(i));
+}
+
+__attribute__((target("avx2"))) auto Bitmap::findAvx2(const std::string_view bytes, const bool bit) noexcept
+    -> unsigned long {
+    const __m256i skippedBlock{bit ? _mm256_setzero_si256() : _mm256_set1_epi8(-1)};
+
+    unsigned long i{};
+    for (; i + sizeof(__m256i) <= bytes.size(); i += sizeof(__m256i)) {
+        const __m256i block{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes.data() + i))};
+        if (static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, skippedBlock))) != ~0U) break;
+    }
+
+    const unsigned long position{findScalar(bytes.substr(i), bit)};
+
+    return position != std::string_view::npos ? i * 8 + position : position;
+}
+
+__attribute__((target("avx2"))) auto Bitmap::applyAvx2(const Operation operation, char *const destination,
+                                                       const char *const source, const unsigned long size) noexcept
+    -> void {
+    const __m256i ones{_mm256_set1_epi8(-1)};
+
+    unsigned long i{};
+    for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i)) {
+        const __m256i left{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(destination + i))},
+            right{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i))};
+
+        __m256i result{right};
+        switch (operation) {
+            case Operation::bitAnd:
+                result = _mm256_and_si256(left, right);
+                break;
+            case Operation::bitOr:
+                result = _mm256_or_si256(left, right);
+                break;
+            case Operation::bitXor:
+                result = _mm256_xor_si256(left, right);
+                break;
+            case Operation::bitNot:
+                result = _mm256_xor_si256(right, ones);
+                break;
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), result);
+    }
+
+    applyScalar(operation, destination + i, source + i, size - i);
+}
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <span>
+#include <string>
+
+class Bitmap {
+public:
+    enum class Operation : unsigned char { bitAnd, bitOr, bitXor, bitNot };
+
+    [[nodiscard]] static auto count(std::string_view bytes) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto find(std::string_view bytes, bool bit) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto combine(Operation operation, std::span<const std::string_view> sources) -> std::string;
+
+    [[nodiscard]] static auto getField(std::string_view bytes, unsigned long offset, unsigned char width) noexcept
+        -> unsigned long;
+
+    static auto setField(std::string &bytes, unsigned long offset, unsigned char width, unsigned long value) -> void;
+
+    [[nodiscard]] static auto countScalar(std::string_view bytes) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto findScalar(std::string_view bytes, bool bit) noexcept -> unsigned long;
+
+    static auto applyScalar(Operation operation, char *destination, const char *source, unsigned long size) noexcept
+        -> void;
+
+#if defined(__x86_64__)
+    [[nodiscard]] static auto countAvx2(std::string_view bytes) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto findAvx2(std::string_view bytes, bool bit) noexcept -> unsigned long;
+
+    static auto applyAvx2(Operation operation, char *destination, const char *source, unsigned long size) noexcept
+        -> void;
+#endif
+
+private:
+    [[nodiscard]] static auto isAvx2() noexcept -> bool;
+};
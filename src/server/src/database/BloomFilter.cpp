@@ -0,0 +1,226 @@
+#include "BloomFilter.hpp"
+
+#include "../config/Config.hpp"
+#include "StringHash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+BloomFilter::BloomFilter(const double errorRate, const unsigned long capacity, const unsigned long expansion) :
+    layers{createLayer(errorRate, capacity)}, expansion{expansion} {}
+
+BloomFilter::BloomFilter(std::span<const std::byte> serialization) {
+    const auto read{[&serialization]<typename T>(T &value) {
+        std::memcpy(&value, serialization.data(), sizeof(value));
+        serialization = serialization.subspan(sizeof(value));
+    }};
+
+    unsigned long layerCount;
+    read(this->expansion);
+    read(layerCount);
+
+    for (unsigned long i{}; i < layerCount; ++i) {
+        Layer layer;
+        unsigned long blockCount;
+        read(layer.capacity);
+        read(layer.size);
+        read(layer.errorRate);
+        read(blockCount);
+
+        layer.blocks.resize(blockCount);
+        std::ranges::copy(serialization.first(blockCount * sizeof(Block)),
+                          std::as_writable_bytes(std::span{layer.blocks}).begin());
+        serialization = serialization.subspan(blockCount * sizeof(Block));
+
+        this->layers.emplace_back(std::move(layer));
+    }
+}
+
+auto BloomFilter::isCreatable(const double errorRate, const unsigned long capacity) noexcept -> bool {
+    return errorRate > 0 && errorRate < 1 && capacity > 0 && isAllocatable(errorRate, capacity, 0);
+}
+
+auto BloomFilter::getMemory() const noexcept -> unsigned long {
+    unsigned long memory{this->layers.capacity() * sizeof(Layer)};
+    for (const auto &layer : this->layers) memory += layer.blocks.capacity() * sizeof(Block);
+
+    return memory;
+}
+
+auto BloomFilter::add(const std::span<const std::string_view> elements) -> std::vector<std::optional<bool>> {
+    const std::vector hashes{hash(elements)};
+    this->prefetch(hashes);
+
+    std::vector<std::optional<bool>> results;
+    for (const unsigned long hash : hashes) {
+        if (this->isContained(hash)) {
+            results.emplace_back(false);
+
+            continue;
+        }
+
+        if (const Layer &last{this->layers.back()}; last.size >= last.capacity) {
+            const double errorRate{last.errorRate * tighteningRatio};
+            const unsigned long capacity{last.capacity * this->expansion};
+            if (this->expansion == 0 || capacity / this->expansion != last.capacity ||
+                !isCreatable(errorRate, capacity) || !isAllocatable(errorRate, capacity, this->getMemory())) {
+                results.emplace_back();
+
+                continue;
+            }
+
+            this->layers.emplace_back(createLayer(errorRate, capacity));
+        }
+
+        Layer &layer{this->layers.back()};
+        insert(layer.blocks[getIndex(layer, hash)], static_cast<unsigned int>(hash));
+        ++layer.size;
+
+        results.emplace_back(true);
+    }
+
+    return results;
+}
+
+auto BloomFilter::contains(const std::span<const std::string_view> elements) const -> std::vector<bool> {
+    const std::vector hashes{hash(elements)};
+    this->prefetch(hashes);
+
+    std::vector<bool> results;
+    for (const unsigned long hash : hashes) results.emplace_back(this->isContained(hash));
+
+    return results;
+}
+
+auto BloomFilter::serialize() const -> std::vector<std::byte> {
+    std::vector<std::byte> serialization;
+    const auto write{[&serialization](const auto &value) {
+        const auto bytes{std::as_bytes(std::span{&value, 1})};
+        serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+    }};
+
+    write(this->expansion);
+    write(this->layers.size());
+    for (const auto &layer : this->layers) {
+        write(layer.capacity);
+        write(layer.size);
+        write(layer.errorRate);
+        write(layer.blocks.size());
+
+        const auto bytes{std::as_bytes(std::span{layer.blocks})};
+        serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+    }
+
+    return serialization;
+}
+
+auto BloomFilter::getBlockCount(const double errorRate, const unsigned long capacity) noexcept -> double {
+    const double bits{-static_cast<double>(salts.size()) * static_cast<double>(capacity) /
+                      std::log1p(-std::pow(errorRate, 1.0 / static_cast<double>(salts.size())))};
+
+    return std::max(std::ceil(bits / (sizeof(Block) * 8)), 1.0);
+}
+
+auto BloomFilter::isAllocatable(const double errorRate, const unsigned long capacity,
+                                const unsigned long memory) noexcept -> bool {
+    const unsigned long maxAllocation{Config::getMaxAllocation()};
+
+    return memory <= maxAllocation &&
+           getBlockCount(errorRate, capacity) <= static_cast<double>((maxAllocation - memory) / sizeof(Block));
+}
+
+auto BloomFilter::createLayer(const double errorRate, const unsigned long capacity) -> Layer {
+    return Layer{std::vector<Block>(static_cast<unsigned long>(getBlockCount(errorRate, capacity))), capacity, 0,
+                 errorRate};
+}
+
+auto BloomFilter::hash(const std::span<const std::string_view> elements) -> std::vector<unsigned long> {
+    std::vector<unsigned long> hashes;
+    hashes.reserve(elements.size());
+    for (const auto element : elements) hashes.emplace_back(StringHash::murmur(element, hashSeed));
+
+    return hashes;
+}
+
+auto BloomFilter::getIndex(const Layer &layer, const unsigned long hash) noexcept -> unsigned long {
+    return (hash >> 32) * layer.blocks.size() >> 32;
+}
+
+auto BloomFilter::isAvx2() noexcept -> bool {
+#if defined(__x86_64__)
+    static const bool isSupported{__builtin_cpu_supports("avx2") != 0};
+
+    return isSupported;
+#else
+    return false;
+#endif
+}
+
+auto BloomFilter::isContained(const Block &block, const unsigned int hash) noexcept -> bool {
+#if defined(__x86_64__)
+    if (isAvx2()) return isContainedAvx2(block, hash);
+#endif
+
+    return isContainedScalar(block, hash);
+}
+
+auto BloomFilter::insert(Block &block, const unsigned int hash) noexcept -> void {
+#if defined(__x86_64__)
+    if (isAvx2()) return insertAvx2(block, hash);
+#endif
+
+    insertScalar(block, hash);
+}
+
+auto BloomFilter::isContainedScalar(const Block &block, const unsigned int hash) noexcept -> bool {
+    for (unsigned long i{}; i < salts.size(); ++i)
+        if ((block.words[i] >> (hash * salts[i] >> 27) & 1) == 0) return false;
+
+    return true;
+}
+
+auto BloomFilter::insertScalar(Block &block, const unsigned int hash) noexcept -> void {
+    for (unsigned long i{}; i < salts.size(); ++i) block.words[i] |= 1U << (hash * salts[i] >> 27);
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) auto BloomFilter::isContainedAvx2(const Block &block, const unsigned int hash) noexcept
+    -> bool {
+    const __m256i mask{_mm256_sllv_epi32(
+        _mm256_set1_epi32(1),
+        _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(hash)),
+                                             _mm256_loadu_si256(reinterpret_cast<const __m256i *>(salts.data()))),
+                          27))};
+
+    return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i *>(block.words.data())), mask) != 0;
+}
+
+__attribute__((target("avx2"))) auto BloomFilter::insertAvx2(Block &block, const unsigned int hash) noexcept -> void {
+    const __m256i mask{_mm256_sllv_epi32(
+        _mm256_set1_epi32(1),
+        _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(hash)),
+                                             _mm256_loadu_si256(reinterpret_cast<const __m256i *>(salts.data()))),
+                          27))};
+
+    const auto words{reinterpret_cast<__m256i *>(block.words.data())};
+    _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), mask));
+}
+#endif
+
+auto BloomFilter::prefetch(const std::span<const unsigned long> hashes) const noexcept -> void {
+    if (hashes.size() < 2) return;
+
+    for (const unsigned long hash : hashes)
+        for (const auto &layer : this->layers) __builtin_prefetch(&layer.blocks[getIndex(layer, hash)]);
+}
+
+auto BloomFilter::isContained(const unsigned long hash) const noexcept -> bool {
+    return std::ranges::any_of(this->layers, [hash](const Layer &layer) {
+        return isContained(layer.blocks[getIndex(layer, hash)], static_cast<unsigned int>(hash));
+    });
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class BloomFilter {
+public:
+    static constexpr double defaultErrorRate{0.01};
+    static constexpr unsigned long defaultCapacity{100}, defaultExpansion{2};
+
+    BloomFilter(double errorRate, unsigned long capacity, unsigned long expansion);
+
+    explicit BloomFilter(std::span<const std::byte> serialization);
+
+    [[nodiscard]] static auto isCreatable(double errorRate, unsigned long capacity) noexcept -> bool;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto add(std::span<const std::string_view> elements) -> std::vector<std::optional<bool>>;
+
+    [[nodiscard]] auto contains(std::span<const std::string_view> elements) const -> std::vector<bool>;
+
+    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+
+private:
+    struct alignas(32) Block {
+        std::array<unsigned int, 8> words;
+    };
+
+    struct Layer {
+        std::vector<Block> blocks;
+        unsigned long capacity, size;
+        double errorRate;
+    };
+
+    static constexpr unsigned long hashSeed{0x5bd1e995};
+    static constexpr double tighteningRatio{0.5};
+    static constexpr std::array<unsigned int, 8> salts{0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+                                                       0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+
+    [[nodiscard]] static auto getBlockCount(double errorRate, unsigned long capacity) noexcept -> double;
+
+    [[nodiscard]] static auto isAllocatable(double errorRate, unsigned long capacity, unsigned long memory) noexcept
+        -> bool;
+
+    [[nodiscard]] static auto createLayer(double errorRate, unsigned long capacity) -> Layer;
+
+    [[nodiscard]] static auto hash(std::span<const std::string_view> elements) -> std::vector<unsigned long>;
+
+    [[nodiscard]] static auto getIndex(const Layer &layer, unsigned long hash) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto isAvx2() noexcept -> bool;
+
+    [[nodiscard]] static auto isContained(const Block &block, unsigned int hash) noexcept -> bool;
+
+    static auto insert(Block &block, unsigned int hash) noexcept -> void;
+
+    [[nodiscard]] static auto isContainedScalar(const Block &block, unsigned int hash) noexcept -> bool;
+
+    static auto insertScalar(Block &block, unsigned int hash) noexcept -> void;
+
+#if defined(__x86_64__)
+    [[nodiscard]] static auto isContainedAvx2(const Block &block, unsigned int hash) noexcept -> bool;
+
+    static auto insertAvx2(Block &block, unsigned int hash) noexcept -> void;
+#endif
+
+    auto prefetch(std::span<const unsigned long> hashes) const noexcept -> void;
+
+    [[nodiscard]] auto isContained(unsigned long hash) const noexcept -> bool;
+
+    std::vector<Layer> layers;
+    unsigned long expansion;
+};
@@ -0,0 +1,84 @@
+#include "CountMinSketch.hpp"
+
+#include "RowHash.hpp"
+#include "StringHash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+
+CountMinSketch::CountMinSketch(const unsigned int width, const unsigned int depth) :
+    counters(static_cast<unsigned long>(width) * depth), width{width}, depth{depth} {}
+
+CountMinSketch::CountMinSketch(std::span<const std::byte> serialization) {
+    const auto read{[&serialization]<typename T>(T &value) {
+        std::memcpy(&value, serialization.data(), sizeof(value));
+        serialization = serialization.subspan(sizeof(value));
+    }};
+
+    read(this->width);
+    read(this->depth);
+
+    this->counters.resize(static_cast<unsigned long>(this->width) * this->depth);
+    std::ranges::copy(serialization.first(this->counters.size() * sizeof(unsigned int)),
+                      std::as_writable_bytes(std::span{this->counters}).begin());
+}
+
+auto CountMinSketch::isCreatable(const unsigned long width, const unsigned long depth) noexcept -> bool {
+    return RowHash::isCreatable(width, depth, sizeof(unsigned int));
+}
+
+auto CountMinSketch::getDimensions(const double error, const double probability) noexcept
+    -> std::pair<unsigned long, unsigned long> {
+    return {static_cast<unsigned long>(std::ceil(std::numbers::e / error)),
+            static_cast<unsigned long>(std::ceil(std::log(1 / probability)))};
+}
+
+auto CountMinSketch::getMemory() const noexcept -> unsigned long {
+    return this->counters.capacity() * sizeof(unsigned int);
+}
+
+auto CountMinSketch::increment(const std::string_view element, const unsigned int value) -> unsigned int {
+    unsigned int result{std::numeric_limits<unsigned int>::max()};
+    for (const unsigned int offset : this->getOffsets(element)) {
+        unsigned int &counter{this->counters[offset]};
+        counter = std::numeric_limits<unsigned int>::max() - counter < value ? std::numeric_limits<unsigned int>::max()
+                                                                               : counter + value;
+
+        result = std::min(result, counter);
+    }
+
+    return result;
+}
+
+auto CountMinSketch::query(const std::string_view element) const -> unsigned int {
+    unsigned int result{std::numeric_limits<unsigned int>::max()};
+    for (const unsigned int offset : this->getOffsets(element)) result = std::min(result, this->counters[offset]);
+
+    return result;
+}
+
+auto CountMinSketch::serialize() const -> std::vector<std::byte> {
+    std::vector<std::byte> serialization;
+    const auto write{[&serialization](const auto &value) {
+        const auto bytes{std::as_bytes(std::span{&value, 1})};
+        serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+    }};
+
+    write(this->width);
+    write(this->depth);
+
+    const auto bytes{std::as_bytes(std::span{this->counters})};
+    serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+
+    return serialization;
+}
+
+auto CountMinSketch::getOffsets(const std::string_view element) const -> std::vector<unsigned int> {
+    std::vector<unsigned int> offsets(this->depth);
+    RowHash::hash(StringHash::murmur(element, hashSeed), this->width, offsets);
+
+    return offsets;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class CountMinSketch {
+public:
+    CountMinSketch(unsigned int width, unsigned int depth);
+
+    explicit CountMinSketch(std::span<const std::byte> serialization);
+
+    [[nodiscard]] static auto isCreatable(unsigned long width, unsigned long depth) noexcept -> bool;
+
+    [[nodiscard]] static auto getDimensions(double error, double probability) noexcept
+        -> std::pair<unsigned long, unsigned long>;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    auto increment(std::string_view element, unsigned int value) -> unsigned int;
+
+    [[nodiscard]] auto query(std::string_view element) const -> unsigned int;
+
+    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+
+private:
+    static constexpr unsigned long hashSeed{0x9747b28c};
+
+    [[nodiscard]] auto getOffsets(std::string_view element) const -> std::vector<unsigned int>;
+
+    std::vector<unsigned int> counters;
+    unsigned int width, depth;
+};
@@ -1,918 +1,2731 @@
 #include "Database.hpp"
 
+#include "../config/Config.hpp"
+#include "Bitmap.hpp"
+#include "Epoch.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
 #include <mutex>
+#include <random>
 #include <ranges>
 
-static constexpr std::string ok{"OK"}, integer{"(integer) "}, nil{"(nil)"}, emptyArray{"(empty array)"};
-static const std::string wrongType{"(error) WRONGTYPE Operation against a key holding the wrong kind of value"},
-    wrongInteger{"(error) ERR value is not an integer or out of range"};
+static auto toError(std::string message) -> Reply { return Reply{Reply::Type::error, std::move(message)}; }
+
+static auto toBulk(std::string value) -> Reply { return Reply{Reply::Type::bulk, std::move(value)}; }
+
+static auto toInteger(const long value) -> Reply { return Reply{value}; }
+
+static const Reply ok{Reply::Type::status, "OK"}, nil{},
+    wrongType{toError("WRONGTYPE Operation against a key holding the wrong kind of value")},
+    wrongInteger{toError("ERR value is not an integer or out of range")},
+    overflow{toError("ERR increment or decrement would overflow")},
+    wrongFloat{toError("ERR value is not a valid float")}, wrongBound{toError("ERR min or max is not a float")},
+    syntaxError{toError("ERR syntax error")};
+
+static constexpr char cursorMarker{'#'};
+
+static auto isOption(const std::string_view token, const std::string_view option) -> bool {
+    return std::ranges::equal(token, option, [](const char left, const char right) {
+        return std::toupper(static_cast<unsigned char>(left)) == right;
+    });
+}
+
+static auto normalizeRange(long &start, long &end, const unsigned long size) noexcept -> bool {
+    const auto length{static_cast<long>(size)};
+    if (start < 0) start = std::max(length + start, 0L);
+    if (end < 0) end += length;
+    if (end >= length) end = length - 1;
+
+    return start <= end;
+}
+
+static auto toArray(const std::span<const std::string> elements) -> Reply {
+    std::vector<Reply> replies;
+    replies.reserve(elements.size());
+    for (const auto &element : elements) replies.emplace_back(toBulk(element));
+
+    return Reply{std::move(replies)};
+}
+
+static auto toScanResult(std::string cursor, const std::span<const std::string> elements) -> Reply {
+    std::vector<Reply> replies;
+    replies.emplace_back(toBulk(std::move(cursor)));
+    replies.emplace_back(toArray(elements));
+
+    return Reply{std::move(replies)};
+}
+
+static auto isMatch(const std::string_view pattern, unsigned long &position, const char character) noexcept -> bool {
+    const char token{pattern[position++]};
+    if (token == '?') return true;
+    if (token == '\\' && position < pattern.size()) return pattern[position++] == character;
+    if (token != '[') return token == character;
+
+    const bool isNegated{position < pattern.size() && pattern[position] == '^'};
+    if (isNegated) ++position;
+
+    bool isMatched{};
+    while (position < pattern.size() && pattern[position] != ']') {
+        if (pattern[position] == '\\' && position + 1 < pattern.size()) {
+            isMatched |= pattern[position + 1] == character;
+            position += 2;
+        } else if (position + 2 < pattern.size() && pattern[position + 1] == '-' && pattern[position + 2] != ']') {
+            const auto [low, high]{std::minmax(pattern[position], pattern[position + 2])};
+            isMatched |= low <= character && character <= high;
+            position += 3;
+        } else isMatched |= pattern[position++] == character;
+    }
+    if (position < pattern.size()) ++position;
+
+    return isMatched != isNegated;
+}
+
+static auto isMatch(const std::string_view pattern, const std::string_view text) noexcept -> bool {
+    unsigned long patternPosition{}, textPosition{}, starPattern{std::string_view::npos}, starText{};
+    while (textPosition < text.size()) {
+        if (patternPosition < pattern.size() && pattern[patternPosition] == '*') {
+            starPattern = ++patternPosition;
+            starText = textPosition;
+
+            continue;
+        }
+
+        if (unsigned long next{patternPosition};
+            patternPosition < pattern.size() && isMatch(pattern, next, text[textPosition])) {
+            patternPosition = next;
+            ++textPosition;
+
+            continue;
+        }
+
+        if (starPattern == std::string_view::npos) return false;
+
+        patternPosition = starPattern;
+        textPosition = ++starText;
+    }
+    while (patternPosition < pattern.size() && pattern[patternPosition] == '*') ++patternPosition;
+
+    return patternPosition == pattern.size();
+}
+
+static auto parseScanOptions(const std::span<const std::string_view> tokens, std::string_view &pattern,
+                             unsigned long &count) -> bool {
+    for (unsigned long i{}; i < tokens.size(); i += 2) {
+        if (i + 1 == tokens.size()) return false;
 
-constexpr auto isInteger(const std::string &integer) {
-    try {
-        std::stol(integer);
-    } catch (const std::invalid_argument &) { return false; }
+        if (isOption(tokens[i], "MATCH")) pattern = tokens[i + 1];
+        else if (isOption(tokens[i], "COUNT")) {
+            const std::optional value{Entry::parseInteger(tokens[i + 1])};
+            if (!value.has_value() || *value <= 0) return false;
+
+            count = *value;
+        } else return false;
+    }
 
     return true;
 }
 
-Database::Database(const unsigned long index, const std::span<const std::byte> data) : index{index}, skiplist{data} {}
+enum class BitfieldOperation : unsigned char { get, set, incrBy };
+
+enum class BitfieldOverflow : unsigned char { wrap, sat, fail };
+
+static auto isBitSet(const std::string_view bytes, const unsigned long position) noexcept -> bool {
+    return static_cast<unsigned char>(bytes[position / 8]) >> position % 8 & 1;
+}
+
+static auto countBits(const std::string_view bytes, unsigned long first, const unsigned long last) noexcept
+    -> unsigned long {
+    unsigned long count{};
+    for (; first <= last && first % 8 != 0; ++first) count += isBitSet(bytes, first);
+    if (const unsigned long size{(last + 1 - first) / 8}; first <= last && size != 0) {
+        count += Bitmap::count(bytes.substr(first / 8, size));
+        first += size * 8;
+    }
+    for (; first <= last; ++first) count += isBitSet(bytes, first);
+
+    return count;
+}
+
+static auto findBit(const std::string_view bytes, const bool bit, unsigned long first,
+                    const unsigned long last) noexcept -> std::optional<unsigned long> {
+    for (; first <= last && first % 8 != 0; ++first)
+        if (isBitSet(bytes, first) == bit) return first;
+    if (const unsigned long size{(last + 1 - first) / 8}; first <= last && size != 0) {
+        if (const unsigned long position{Bitmap::find(bytes.substr(first / 8, size), bit)};
+            position != std::string_view::npos)
+            return first + position;
+        first += size * 8;
+    }
+    for (; first <= last; ++first)
+        if (isBitSet(bytes, first) == bit) return first;
+
+    return {};
+}
+
+static auto parseBitRange(const std::span<const std::string_view> tokens, long &start, long &end, bool &isBit)
+    -> std::optional<Reply> {
+    if (!tokens.empty()) {
+        const std::optional result{Entry::parseInteger(tokens.front())};
+        if (!result.has_value()) return wrongInteger;
+
+        start = *result;
+    }
+    if (tokens.size() > 1) {
+        const std::optional result{Entry::parseInteger(tokens[1])};
+        if (!result.has_value()) return wrongInteger;
+
+        end = *result;
+    }
+    if (tokens.size() > 2) {
+        if (isOption(tokens[2], "BIT")) isBit = true;
+        else if (!isOption(tokens[2], "BYTE")) return syntaxError;
+    }
+    if (tokens.size() > 3) return syntaxError;
+
+    return {};
+}
+
+static auto parseBitfieldType(const std::string_view token) noexcept -> std::optional<std::pair<bool, unsigned char>> {
+    if (token.size() < 2) return {};
+
+    const bool isSigned{token.front() == 'i' || token.front() == 'I'};
+    if (!isSigned && token.front() != 'u' && token.front() != 'U') return {};
+
+    const std::optional width{Entry::parseInteger(token.substr(1))};
+    if (!width.has_value() || *width < 1 || *width > (isSigned ? 64 : 63)) return {};
+
+    return std::pair{isSigned, static_cast<unsigned char>(*width)};
+}
+
+static auto parseBitfieldOffset(const std::string_view token, const unsigned char width) noexcept
+    -> std::optional<unsigned long> {
+    const bool isMultiplied{token.starts_with('#')};
+
+    const std::optional offset{Entry::parseInteger(isMultiplied ? token.substr(1) : token)};
+    if (!offset.has_value() || *offset < 0) return {};
+
+    const unsigned long result{isMultiplied ? static_cast<unsigned long>(*offset) * width : *offset};
+    if (result > (1UL << 32) - width) return {};
+
+    return result;
+}
+
+static auto toBitfieldValue(const unsigned long bits, const bool isSigned, const unsigned char width) noexcept -> long {
+    if (isSigned && width < 64 && (bits >> (width - 1) & 1)) return static_cast<long>(bits | ~0UL << width);
+
+    return static_cast<long>(bits);
+}
+
+static auto fitBitfieldValue(const long base, const long increment, const bool isSigned, const unsigned char width,
+                             const BitfieldOverflow overflow) noexcept -> std::optional<long> {
+    const auto max{static_cast<long>((1UL << (isSigned ? width - 1 : width)) - 1)}, min{isSigned ? -max - 1 : 0};
+
+    long value;
+    const bool isOverflowed{__builtin_add_overflow(base, increment, &value)};
+    if (!isOverflowed && min <= value && value <= max) return value;
+
+    switch (overflow) {
+        case BitfieldOverflow::fail:
+            return {};
+        case BitfieldOverflow::sat:
+            return (isOverflowed ? increment > 0 : value > max) ? max : min;
+        default:
+            {
+                const unsigned long bits{static_cast<unsigned long>(base) + static_cast<unsigned long>(increment)};
+
+                return toBitfieldValue(width < 64 ? bits & ((1UL << width) - 1) : bits, isSigned, width);
+            }
+    }
+}
+
+Database::Database(const unsigned long index, std::span<const std::byte> data) : index{index} {
+    std::array<std::vector<std::span<const std::byte>>, shardCount> serializedEntries;
+    while (!data.empty()) {
+        const auto size{*reinterpret_cast<const unsigned long *>(data.data())};
+        data = data.subspan(sizeof(size));
+
+        const std::span serializedEntry{data.subspan(0, size)};
+        serializedEntries[getShardIndex(Entry::deserializeKey(serializedEntry))].emplace_back(serializedEntry);
+        data = data.subspan(size);
+    }
+
+    for (unsigned long i{}; i < shardCount; ++i) {
+        Shard &shard{this->shards[i]};
+
+        shard.skiplist = Skiplist{*this->arena, serializedEntries[i]};
+        shard.skiplist.traverse([this, &shard](Node *const node) {
+            shard.hashIndex.insert(node);
+            if (node->getEntry().getExpiration() != 0) shard.volatileKeys.emplace(node->getKey());
+            this->account(node->getKey(), node->getEntry());
+            if (Config::getMaxmemory() != 0) node->getEntry().touch();
+        });
+    }
+}
 
 Database::Database(Database &&other) noexcept {
-    const std::lock_guard lockGuard{other.lock};
+    const std::vector lockGuards{other.lockAll()};
 
     this->index = other.index;
-    this->skiplist = std::move(other.skiplist);
+    this->memory = other.memory.exchange(0);
+    this->snapshotVersion = other.snapshotVersion.load();
+    for (unsigned long i{}; i < shardCount; ++i) {
+        this->shards[i].skiplist = std::move(other.shards[i].skiplist);
+        this->shards[i].hashIndex = std::move(other.shards[i].hashIndex);
+        this->shards[i].volatileKeys = std::move(other.shards[i].volatileKeys);
+    }
+    this->arena = std::move(other.arena);
 }
 
 auto Database::operator=(Database &&other) noexcept -> Database & {
-    const std::scoped_lock scopedLock{this->lock, other.lock};
-
     if (this == &other) return *this;
 
+    const std::vector lockGuards{this->lockAll()}, otherLockGuards{other.lockAll()};
+
     this->index = other.index;
-    this->skiplist = std::move(other.skiplist);
+    this->memory = other.memory.exchange(0);
+    this->snapshotVersion = other.snapshotVersion.load();
+    for (unsigned long i{}; i < shardCount; ++i) {
+        this->shards[i].skiplist = std::move(other.shards[i].skiplist);
+        this->shards[i].hashIndex = std::move(other.shards[i].hashIndex);
+        this->shards[i].volatileKeys = std::move(other.shards[i].volatileKeys);
+    }
+    this->arena = std::move(other.arena);
 
     return *this;
 }
 
+auto Database::snapshot() noexcept -> void {
+    this->snapshotVersion.fetch_add(1, std::memory_order::relaxed);
+    this->isSnapshotting.store(true, std::memory_order::release);
+}
+
 auto Database::serialize() -> std::vector<std::byte> {
-    std::vector<std::byte> data{sizeof(this->index)};
+    std::vector<std::byte> data{sizeof(this->index) + sizeof(unsigned long)};
     *reinterpret_cast<decltype(this->index) *>(data.data()) = this->index;
 
-    const std::shared_lock sharedLock{this->lock};
+    const unsigned long version{this->snapshotVersion.load(std::memory_order::relaxed)};
+    for (Shard &shard : this->shards) {
+        std::string cursor;
+        for (bool isEnd{}; !isEnd;) {
+            const std::shared_lock sharedLock{shard.lock};
+
+            isEnd = true;
+            unsigned long count{};
+            shard.skiplist.traverse(cursor, [&](Node *const node) {
+                if (count++ == snapshotBatchSize) {
+                    cursor = node->getKey();
+                    isEnd = false;
+
+                    return false;
+                }
+
+                if (node->claim(version)) {
+                    const std::vector serializedEntry{node->getEntry().serialize(node->getKey())};
+                    data.insert(data.cend(), serializedEntry.cbegin(), serializedEntry.cend());
+                }
+
+                return true;
+            });
+        }
+
+        const std::lock_guard lockGuard{shard.lock};
+        data.insert(data.cend(), shard.snapshot.cbegin(), shard.snapshot.cend());
+        shard.snapshot = {};
+    }
+    this->isSnapshotting.store(false, std::memory_order::release);
 
-    const std::vector serialization{this->skiplist.serialize()};
-    data.insert(data.cend(), serialization.cbegin(), serialization.cend());
+    *reinterpret_cast<unsigned long *>(data.data() + sizeof(this->index)) =
+        data.size() - sizeof(this->index) - sizeof(unsigned long);
 
     return data;
 }
 
-auto Database::del(const std::string_view statement) -> std::string {
+auto Database::activeExpire(const std::chrono::steady_clock::time_point deadline) -> void {
+    thread_local std::mt19937 generator{std::random_device{}()};
+
+    for (unsigned long i{}; i < shardCount; ++i, this->expireCursor = (this->expireCursor + 1) % shardCount) {
+        Shard &shard{this->shards[this->expireCursor]};
+
+        while (true) {
+            unsigned long sampleCount{}, expiredCount{};
+
+            {
+                const std::lock_guard lockGuard{shard.lock};
+                if (shard.volatileKeys.empty()) break;
+
+                const long now{getTime()};
+                const unsigned long bucketCount{shard.volatileKeys.bucket_count()};
+                std::vector<std::string> expiredKeys;
+                for (unsigned long bucket{std::uniform_int_distribution<unsigned long>{0, bucketCount - 1}(generator)},
+                     scanned{};
+                     sampleCount < expireSampleCount && scanned < bucketCount; bucket = (bucket + 1) % bucketCount,
+                     ++scanned) {
+                    for (auto key{shard.volatileKeys.cbegin(bucket)};
+                         key != shard.volatileKeys.cend(bucket) && sampleCount < expireSampleCount; ++key) {
+                        if (Node *const node{shard.hashIndex.find(*key)};
+                            node == nullptr || node->getEntry().getExpiration() <= now)
+                            expiredKeys.emplace_back(*key);
+                        ++sampleCount;
+                    }
+                }
+
+                for (const auto &key : expiredKeys) this->erase(key);
+                expiredCount = expiredKeys.size();
+            }
+
+            if (expiredCount * 4 <= sampleCount || std::chrono::steady_clock::now() >= deadline) break;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) return;
+    }
+}
+
+auto Database::getMemory() const noexcept -> unsigned long { return this->memory.load(std::memory_order::relaxed); }
+
+auto Database::refresh(const std::string_view key) -> void {
+    const std::lock_guard lockGuard{this->getShard(key).lock};
+
+    if (Node *const node{this->getShard(key).hashIndex.find(key)}; node != nullptr)
+        this->account(node->getKey(), node->getEntry());
+}
+
+auto Database::sample(std::vector<EvictionCandidate> &candidates) -> void {
+    thread_local std::mt19937 generator{std::random_device{}()};
+
+    const Config::MaxmemoryPolicy policy{Config::getMaxmemoryPolicy()};
+    const bool isVolatile{policy >= Config::MaxmemoryPolicy::volatileLru};
+    const unsigned long sampleCount{Config::getMaxmemorySamples()},
+        first{std::uniform_int_distribution<unsigned long>{0, shardCount - 1}(generator)};
+    for (unsigned long i{}; i < shardCount; ++i) {
+        Shard &shard{this->shards[(first + i) % shardCount]};
+        const std::shared_lock sharedLock{shard.lock};
+
+        std::vector<Node *> nodes;
+        if (!isVolatile) nodes = shard.hashIndex.sample(generator(), sampleCount);
+        else if (!shard.volatileKeys.empty()) {
+            const unsigned long bucketCount{shard.volatileKeys.bucket_count()};
+            for (unsigned long bucket{std::uniform_int_distribution<unsigned long>{0, bucketCount - 1}(generator)},
+                 scanned{};
+                 nodes.size() < sampleCount && scanned < bucketCount; bucket = (bucket + 1) % bucketCount, ++scanned) {
+                for (auto key{shard.volatileKeys.cbegin(bucket)};
+                     key != shard.volatileKeys.cend(bucket) && nodes.size() < sampleCount; ++key)
+                    if (Node *const node{shard.hashIndex.find(*key)}; node != nullptr) nodes.emplace_back(node);
+            }
+        }
+        if (nodes.empty()) continue;
+
+        for (Node *const node : nodes) {
+            const Entry &entry{node->getEntry()};
+
+            unsigned long idle;
+            switch (policy) {
+                case Config::MaxmemoryPolicy::allkeysRandom:
+                case Config::MaxmemoryPolicy::volatileRandom:
+                    idle = generator();
+                    break;
+                case Config::MaxmemoryPolicy::volatileTtl:
+                    idle = std::numeric_limits<unsigned long>::max() - entry.getExpiration();
+                    break;
+                default:
+                    idle = entry.getIdle();
+            }
+
+            candidates.emplace_back(idle, this->index, std::string{node->getKey()});
+        }
+
+        return;
+    }
+}
+
+auto Database::evict(const std::string_view key) -> bool {
+    const std::lock_guard lockGuard{this->getShard(key).lock};
+
+    return this->erase(key);
+}
+
+auto Database::del(const std::span<const std::string_view> arguments) -> Reply {
     unsigned long count{};
 
     {
-        std::vector<std::string_view> keys;
-        for (const auto &view : statement | std::views::split(' ')) keys.emplace_back(view);
-
-        const std::lock_guard lockGuard{this->lock};
+        const std::vector lockGuards{this->lock(arguments)};
 
-        for (const auto key : keys) count += this->skiplist.erase(key);
+        for (const auto key : arguments) {
+            const bool isExist{this->find(key) != nullptr};
+            this->erase(key);
+            count += isExist;
+        }
     }
 
-    return integer + std::to_string(count);
+    return toInteger(count);
 }
 
-auto Database::exists(const std::string_view statement) -> std::string {
+auto Database::exists(const std::span<const std::string_view> arguments) -> Reply {
     unsigned long count{};
 
     {
-        std::vector<std::string_view> keys;
-        for (const auto &view : statement | std::views::split(' ')) keys.emplace_back(view);
+        const Epoch::Guard guard;
+
+        for (const auto key : arguments)
+            if (this->peek(key) != nullptr) ++count;
+    }
+
+    return toInteger(count);
+}
+
+auto Database::move(std::unordered_map<unsigned long, Database> &databases,
+                    const std::span<const std::string_view> arguments) -> Reply {
+    bool isSuccess{};
+
+    {
+        const auto key{arguments[0]};
+
+        const std::optional targetIndex{Entry::parseInteger(arguments[1])};
+        if (!targetIndex.has_value() || *targetIndex < 0) return toError("ERR index out of range");
+
+        if (const auto targetResult{databases.find(*targetIndex)}; targetResult != databases.cend()) {
+            Database &target{targetResult->second};
+            if (&target == this) return toError("ERR source and destination objects are the same");
+
+            const std::scoped_lock scopedLock{this->getShard(key).lock, target.getShard(key).lock};
+
+            if (Entry *const entry{this->find(key)}; entry != nullptr && target.find(key) == nullptr) {
+                Entry value{detach(*entry)};
+                this->erase(key);
+                target.insert(key, std::move(value));
+
+                isSuccess = true;
+            }
+        }
+    }
+
+    return toInteger(isSuccess);
+}
+
+auto Database::rename(const std::span<const std::string_view> arguments) -> Reply {
+    const auto key{arguments[0]}, newKey{arguments[1]};
+
+    const std::vector lockGuards{this->lock(arguments)};
+
+    if (Entry *const entry{this->find(key)}; entry != nullptr) {
+        Entry value{detach(*entry)};
+        this->erase(key);
+        this->insert(newKey, std::move(value));
+
+        return ok;
+    }
+
+    return toError("ERR no such key");
+}
+
+auto Database::renamenx(const std::span<const std::string_view> arguments) -> Reply {
+    bool isSuccess{};
+
+    {
+        const auto key{arguments[0]}, newKey{arguments[1]};
+
+        const std::vector lockGuards{this->lock(arguments)};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr && this->find(newKey) == nullptr) {
+            Entry value{detach(*entry)};
+            this->erase(key);
+            this->insert(newKey, std::move(value));
+
+            isSuccess = true;
+        }
+    }
+
+    return toInteger(isSuccess);
+}
+
+auto Database::type(const std::span<const std::string_view> arguments) -> Reply {
+    const auto key{arguments.front()};
+
+    const std::shared_lock sharedLock{this->getShard(key).lock};
+
+    if (Entry *const entry{this->find(key)}; entry != nullptr) {
+        switch (entry->getType()) {
+            case Entry::Type::string:
+                return Reply{Reply::Type::status, "string"};
+            case Entry::Type::hash:
+                return Reply{Reply::Type::status, "hash"};
+            case Entry::Type::list:
+                return Reply{Reply::Type::status, "list"};
+            case Entry::Type::set:
+                return Reply{Reply::Type::status, "set"};
+            case Entry::Type::sortedSet:
+                return Reply{Reply::Type::status, "zset"};
+            case Entry::Type::hyperLogLog:
+                return Reply{Reply::Type::status, "hyperloglog"};
+            case Entry::Type::bloomFilter:
+                return Reply{Reply::Type::status, "bloomfilter"};
+            case Entry::Type::countMinSketch:
+                return Reply{Reply::Type::status, "countminsketch"};
+            case Entry::Type::topK:
+                return Reply{Reply::Type::status, "topk"};
+        }
+    }
+
+    return Reply{Reply::Type::status, "none"};
+}
+
+auto Database::scan(const std::span<const std::string_view> arguments) -> Reply {
+    std::string_view pattern{"*"};
+    unsigned long count{10};
+    if (!parseScanOptions(arguments.subspan(1), pattern, count)) return syntaxError;
+
+    std::string_view cursor{arguments.front()};
+    if (cursor != "0" && !cursor.starts_with(cursorMarker)) return toError("ERR invalid cursor");
+    const bool isStarted{cursor != "0"};
+    if (isStarted) cursor.remove_prefix(1);
+
+    const std::string_view prefix{pattern.substr(0, pattern.find_first_of("*?[\\"))};
+    std::string_view start{isStarted ? cursor : std::string_view{}};
+    bool isExclusive{isStarted};
+    if (start < prefix) {
+        start = prefix;
+        isExclusive = false;
+    }
+
+    auto [keys, next]{this->collect(
+        start, isExclusive, [prefix](const std::string_view key) { return key.starts_with(prefix); }, count)};
+    if (pattern != "*") std::erase_if(keys, [pattern](const std::string_view key) { return !isMatch(pattern, key); });
+
+    return toScanResult(next.has_value() ? cursorMarker + *next : "0", keys);
+}
+
+auto Database::range(const std::span<const std::string_view> arguments) -> Reply {
+    if (arguments.size() != 2 && arguments.size() != 4) return syntaxError;
+
+    unsigned long limit{10};
+    if (arguments.size() == 4) {
+        const std::optional value{Entry::parseInteger(arguments[3])};
+        if (!isOption(arguments[2], "LIMIT") || !value.has_value() || *value <= 0) return syntaxError;
+
+        limit = *value;
+    }
+
+    std::string_view start{arguments[0]}, end{arguments[1]};
+    const bool isStartExclusive{start.starts_with('(')}, isEndExclusive{end.starts_with('(')};
+    if (start == "-") start = {};
+    else if (isStartExclusive) start.remove_prefix(1);
+    if (isEndExclusive) end.remove_prefix(1);
+
+    const std::vector keys{
+        this->collect(start, isStartExclusive,
+                      [end, isUnbounded = end == "+", isEndExclusive](const std::string_view key) {
+                          return isUnbounded || (isEndExclusive ? key < end : key <= end);
+                      },
+                      limit)
+            .first};
+
+    return toArray(keys);
+}
+
+auto Database::expire(const std::span<const std::string_view> arguments) -> Reply {
+    return this->setDeadline(arguments, "EX");
+}
+
+auto Database::expireAt(const std::span<const std::string_view> arguments) -> Reply {
+    return this->setDeadline(arguments, "EXAT");
+}
+
+auto Database::pexpire(const std::span<const std::string_view> arguments) -> Reply {
+    return this->setDeadline(arguments, "PX");
+}
+
+auto Database::pexpireAt(const std::span<const std::string_view> arguments) -> Reply {
+    return this->setDeadline(arguments, "PXAT");
+}
+
+auto Database::persist(const std::span<const std::string_view> arguments) -> Reply {
+    bool isPersisted{};
+
+    {
+        const auto key{arguments.front()};
+
+        Shard &shard{this->getShard(key)};
+        const std::lock_guard lockGuard{shard.lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr && entry->getExpiration() != 0) {
+            entry->setExpiration(0);
+            if (const auto result{shard.volatileKeys.find(key)}; result != shard.volatileKeys.cend())
+                shard.volatileKeys.erase(result);
+
+            isPersisted = true;
+        }
+    }
+
+    return toInteger(isPersisted);
+}
+
+auto Database::pttl(const std::span<const std::string_view> arguments) -> Reply {
+    return this->getRemaining(arguments.front(), true);
+}
+
+auto Database::ttl(const std::span<const std::string_view> arguments) -> Reply {
+    return this->getRemaining(arguments.front(), false);
+}
+
+auto Database::set(const std::span<const std::string_view> arguments) -> Reply {
+    {
+        if (arguments.size() != 2 && arguments.size() != 4) return syntaxError;
+
+        const auto key{arguments[0]}, value{arguments[1]};
+
+        const std::optional expiration{parseExpiration(arguments.subspan(2))};
+        if (!expiration.has_value()) return toError("ERR invalid expire time in 'set' command");
+
+        Entry entry{std::string{value}};
+        entry.setExpiration(*expiration);
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        this->insert(key, std::move(entry));
+    }
+
+    return ok;
+}
+
+auto Database::get(const std::span<const std::string_view> arguments) -> Reply {
+    return this->peek(arguments.front(), [](const Entry *const entry) -> Reply {
+        if (entry == nullptr) return nil;
+        if (entry->getType() != Entry::Type::string) return wrongType;
+
+        return toBulk(entry->toString());
+    });
+}
+
+auto Database::getRange(const std::span<const std::string_view> arguments) -> Reply {
+    const auto key{arguments[0]};
+
+    const std::optional startArgument{Entry::parseInteger(arguments[1])},
+        endArgument{Entry::parseInteger(arguments[2])};
+    if (!startArgument.has_value() || !endArgument.has_value()) return wrongInteger;
+    auto start{*startArgument}, end{*endArgument};
+
+    std::string result;
+
+    {
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::string) return wrongType;
+
+            std::string buffer;
+            const std::string_view bytes{entry->getBytes(buffer)};
+            const auto entryValueSize{static_cast<decltype(start)>(bytes.size())};
+
+            start = start < 0 ? entryValueSize + start : start;
+            if (start < 0) start = 0;
+
+            end = end < 0 ? entryValueSize + end : end;
+            ++end;
+            if (end > entryValueSize) end = entryValueSize;
+
+            if (start < entryValueSize && end > 0 && start < end)
+                result = bytes.substr(start, end - start);
+        }
+    }
+
+    return toBulk(result);
+}
+
+auto Database::getBit(const std::span<const std::string_view> arguments) -> Reply {
+    bool bit{};
+
+    {
+        const auto key{arguments[0]};
+
+        const std::optional offset{Entry::parseInteger(arguments[1])};
+        if (!offset.has_value() || *offset < 0) return toError("ERR bit offset is not an integer or out of range");
+        const auto position{static_cast<unsigned long>(*offset)};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::string) {
+                std::string buffer;
+                if (const std::string_view bytes{entry->getBytes(buffer)}; position / 8 < bytes.size())
+                    bit = isBitSet(bytes, position);
+            } else return wrongType;
+        }
+    }
+
+    return toInteger(bit);
+}
+
+auto Database::mget(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<Reply> replies;
+    for (const auto key : arguments) {
+        replies.emplace_back(this->peek(key, [](const Entry *const entry) -> Reply {
+            return entry != nullptr && entry->getType() == Entry::Type::string ? toBulk(entry->toString()) : nil;
+        }));
+    }
+
+    return Reply{std::move(replies)};
+}
+
+auto Database::setBit(const std::span<const std::string_view> arguments) -> Reply {
+    bool oldBit{};
+
+    {
+        const auto key{arguments[0]};
+
+        const std::optional offset{Entry::parseInteger(arguments[1])};
+        if (!offset.has_value() || *offset < 0 || *offset >= 1L << 32)
+            return toError("ERR bit offset is not an integer or out of range");
+        if (arguments[2] != "0" && arguments[2] != "1") return toError("ERR bit is not an integer or out of range");
+
+        const unsigned long index{static_cast<unsigned long>(*offset) / 8};
+        const auto position{static_cast<unsigned char>(*offset % 8)};
+        const auto value{arguments[2] == "1"};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::string) {
+                this->update(key, *entry, [index, position, value, &oldBit](std::string &bytes) {
+                    if (index >= bytes.size()) bytes.resize(index + 1);
+
+                    char &element{bytes[index]};
+                    oldBit = element >> position & 1;
+
+                    if (value) element = static_cast<char>(element | 1 << position);
+                    else element = static_cast<char>(element & ~(1 << position));
+                });
+            } else return wrongType;
+        } else {
+            std::string newValue(index + 1, 0);
+            if (char &element{newValue[index]}; value) element = static_cast<char>(element | 1 << position);
+
+            this->insert(key, Entry{std::move(newValue)});
+        }
+    }
+
+    return toInteger(oldBit);
+}
+
+auto Database::bitCount(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.size() == 2) return syntaxError;
+
+        long start{}, end{-1};
+        bool isBit{};
+        if (const std::optional error{parseBitRange(arguments.subspan(1), start, end, isBit)};
+            error.has_value())
+            return *error;
+
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
+
+        Entry *const entry{this->find(arguments.front())};
+        if (entry == nullptr) return toInteger(0);
+        if (entry->getType() != Entry::Type::string) return wrongType;
+
+        std::string buffer;
+        const std::string_view bytes{entry->getBytes(buffer)};
+        if (!normalizeRange(start, end, isBit ? bytes.size() * 8 : bytes.size())) return toInteger(0);
+
+        count = isBit ? countBits(bytes, start, end) : Bitmap::count(bytes.substr(start, end - start + 1));
+    }
+
+    return toInteger(count);
+}
+
+auto Database::bitPos(const std::span<const std::string_view> arguments) -> Reply {
+    long position{-1};
+
+    {
+        if (arguments.size() < 2) return syntaxError;
+        if (arguments[1] != "0" && arguments[1] != "1") return toError("ERR The bit argument must be 1 or 0.");
+        const bool bit{arguments[1] == "1"}, isEndGiven{arguments.size() > 3};
+
+        long start{}, end{-1};
+        bool isBit{};
+        if (const std::optional error{parseBitRange(arguments.subspan(2), start, end, isBit)};
+            error.has_value())
+            return *error;
+
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
+
+        Entry *const entry{this->find(arguments.front())};
+        if (entry == nullptr) return toInteger(bit ? -1 : 0);
+        if (entry->getType() != Entry::Type::string) return wrongType;
+
+        std::string buffer;
+        const std::string_view bytes{entry->getBytes(buffer)};
+        if (!normalizeRange(start, end, isBit ? bytes.size() * 8 : bytes.size())) return toInteger(-1);
+        if (!isBit) {
+            start *= 8;
+            end = end * 8 + 7;
+        }
+
+        if (const std::optional result{findBit(bytes, bit, start, end)}; result.has_value())
+            position = static_cast<long>(*result);
+        else if (!bit && !isEndGiven) position = static_cast<long>(bytes.size() * 8);
+    }
+
+    return toInteger(position);
+}
+
+auto Database::bitOp(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size;
+
+    {
+        if (arguments.size() < 3) return syntaxError;
+
+        Bitmap::Operation operation;
+        if (isOption(arguments.front(), "AND")) operation = Bitmap::Operation::bitAnd;
+        else if (isOption(arguments.front(), "OR")) operation = Bitmap::Operation::bitOr;
+        else if (isOption(arguments.front(), "XOR")) operation = Bitmap::Operation::bitXor;
+        else if (isOption(arguments.front(), "NOT")) {
+            if (arguments.size() != 3) return toError("ERR BITOP NOT must be called with a single source key.");
+
+            operation = Bitmap::Operation::bitNot;
+        } else return syntaxError;
+
+        const std::span keys{arguments.subspan(1)};
+        const auto destination{keys.front()};
+
+        const std::vector lockGuards{this->lock(keys)};
+
+        std::vector<std::string> buffers(keys.size() - 1);
+        std::vector<std::string_view> sources;
+        for (unsigned long i{1}; i < keys.size(); ++i) {
+            if (Entry *const entry{this->find(keys[i])}; entry != nullptr) {
+                if (entry->getType() != Entry::Type::string) return wrongType;
+
+                sources.emplace_back(entry->getBytes(buffers[i - 1]));
+            } else sources.emplace_back();
+        }
+
+        std::string result{Bitmap::combine(operation, sources)};
+        size = result.size();
+
+        if (result.empty()) this->erase(destination);
+        else this->insert(destination, Entry{std::move(result)});
+    }
+
+    return toInteger(size);
+}
+
+auto Database::bitField(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<Reply> replies;
+
+    {
+        const auto key{arguments.front()};
+
+        struct Field {
+            BitfieldOperation operation;
+            bool isSigned;
+            unsigned char width;
+            unsigned long offset;
+            long argument;
+            BitfieldOverflow overflow;
+        };
+
+        std::vector<Field> fields;
+        BitfieldOverflow overflow{BitfieldOverflow::wrap};
+        for (unsigned long i{1}; i < arguments.size();) {
+            if (isOption(arguments[i], "OVERFLOW")) {
+                if (i + 1 == arguments.size()) return syntaxError;
+
+                if (isOption(arguments[i + 1], "WRAP")) overflow = BitfieldOverflow::wrap;
+                else if (isOption(arguments[i + 1], "SAT")) overflow = BitfieldOverflow::sat;
+                else if (isOption(arguments[i + 1], "FAIL")) overflow = BitfieldOverflow::fail;
+                else return toError("ERR Invalid OVERFLOW type specified");
+                i += 2;
+
+                continue;
+            }
+
+            BitfieldOperation operation;
+            if (isOption(arguments[i], "GET")) operation = BitfieldOperation::get;
+            else if (isOption(arguments[i], "SET")) operation = BitfieldOperation::set;
+            else if (isOption(arguments[i], "INCRBY")) operation = BitfieldOperation::incrBy;
+            else return syntaxError;
+
+            const unsigned long argumentCount{operation == BitfieldOperation::get ? 2UL : 3UL};
+            if (i + argumentCount >= arguments.size()) return syntaxError;
+
+            const std::optional type{parseBitfieldType(arguments[i + 1])};
+            if (!type.has_value())
+                return toError("ERR Invalid bitfield type. Use something like i16 u8. "
+                               "Note that u64 is not supported but i64 is.");
+
+            const std::optional offset{parseBitfieldOffset(arguments[i + 2], type->second)};
+            if (!offset.has_value()) return toError("ERR bit offset is not an integer or out of range");
+
+            std::optional<long> argument{0};
+            if (operation != BitfieldOperation::get) {
+                argument = Entry::parseInteger(arguments[i + 3]);
+                if (!argument.has_value()) return wrongInteger;
+            }
+
+            fields.emplace_back(operation, type->first, type->second, *offset, *argument, overflow);
+            i += argumentCount + 1;
+        }
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        Entry *const entry{this->find(key)};
+        if (entry != nullptr && entry->getType() != Entry::Type::string) return wrongType;
+
+        const bool isInPlace{entry != nullptr && entry->isEditedInPlace()};
+        std::string copy{entry != nullptr && !isInPlace ? entry->toString() : std::string{}};
+        std::string &bytes{isInPlace ? entry->getString() : copy};
+        bool isModified{};
+
+        for (const auto &field : fields) {
+            const long oldValue{
+                toBitfieldValue(Bitmap::getField(bytes, field.offset, field.width), field.isSigned, field.width)};
+            if (field.operation == BitfieldOperation::get) {
+                replies.emplace_back(toInteger(oldValue));
+
+                continue;
+            }
+
+            const std::optional newValue{field.operation == BitfieldOperation::set
+                                             ? fitBitfieldValue(field.argument, 0, field.isSigned, field.width,
+                                                                field.overflow)
+                                             : fitBitfieldValue(oldValue, field.argument, field.isSigned, field.width,
+                                                                field.overflow)};
+            if (newValue.has_value()) {
+                Bitmap::setField(bytes, field.offset, field.width, static_cast<unsigned long>(*newValue));
+                isModified = true;
+            }
+
+            if (!newValue.has_value()) replies.emplace_back(nil);
+            else
+                replies.emplace_back(toInteger(field.operation == BitfieldOperation::set ? oldValue : *newValue));
+        }
+
+        if (entry != nullptr) {
+            if (isModified && !isInPlace) this->replace(key, *entry, Entry{std::move(copy)});
+        } else if (!bytes.empty()) this->insert(key, Entry{std::move(copy)});
+    }
+
+    return Reply{std::move(replies)};
+}
+
+auto Database::setnx(const std::span<const std::string_view> arguments) -> Reply {
+    bool isSuccess{};
+
+    {
+        const auto key{arguments[0]};
+        std::string value{arguments[1]};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (this->find(key) == nullptr) {
+            this->insert(key, Entry{std::move(value)});
+
+            isSuccess = true;
+        }
+    }
+
+    return toInteger(isSuccess);
+}
+
+auto Database::setRange(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size;
+
+    {
+        const auto key{arguments[0]}, value{arguments[2]};
+
+        const std::optional offsetArgument{Entry::parseInteger(arguments[1])};
+        if (!offsetArgument.has_value() || *offsetArgument < 0) return toError("ERR offset is out of range");
+
+        const auto offset{static_cast<unsigned long>(*offsetArgument)}, end{offset + value.size()};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::string) {
+                this->update(key, *entry, [offset, end, value, &size](std::string &bytes) {
+                    const unsigned long oldEnd{bytes.size()};
+
+                    if (end > oldEnd) bytes.resize(end);
+                    if (offset > oldEnd) bytes.replace(oldEnd, offset - oldEnd, offset - oldEnd, '\0');
+
+                    bytes.replace(offset, value.size(), value);
+                    size = bytes.size();
+                });
+            } else return wrongType;
+        } else {
+            std::string newValue{std::string(offset, '\0') + std::string{value}};
+            size = newValue.size();
+
+            this->insert(key, Entry{std::move(newValue)});
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::strlen(const std::span<const std::string_view> arguments) -> Reply {
+    return this->peek(arguments.front(), [](const Entry *const entry) -> Reply {
+        if (entry == nullptr) return toInteger(0);
+        if (entry->getType() != Entry::Type::string) return wrongType;
+
+        std::string buffer;
+
+        return toInteger(static_cast<long>(entry->getBytes(buffer).size()));
+    });
+}
+
+auto Database::mset(const std::span<const std::string_view> arguments) -> Reply {
+    {
+        if (arguments.size() % 2 != 0) return toError("ERR wrong number of arguments for 'mset' command");
+
+        std::vector<std::string_view> keys;
+        for (unsigned long i{}; i < arguments.size(); i += 2) keys.emplace_back(arguments[i]);
+        const std::vector lockGuards{this->lock(keys)};
+
+        for (unsigned long i{}; i < arguments.size(); i += 2)
+            this->insert(arguments[i], Entry{std::string{arguments[i + 1]}});
+    }
+
+    return ok;
+}
+
+auto Database::msetnx(const std::span<const std::string_view> arguments) -> Reply {
+    bool isSuccess;
+
+    {
+        if (arguments.size() % 2 != 0) return toError("ERR wrong number of arguments for 'msetnx' command");
+
+        std::vector<std::string_view> keys;
+        for (unsigned long i{}; i < arguments.size(); i += 2) keys.emplace_back(arguments[i]);
+        const std::vector lockGuards{this->lock(keys)};
+
+        isSuccess =
+            std::ranges::none_of(keys, [this](const std::string_view key) { return this->find(key) != nullptr; });
+        if (isSuccess) {
+            for (unsigned long i{}; i < arguments.size(); i += 2)
+                this->insert(arguments[i], Entry{std::string{arguments[i + 1]}});
+        }
+    }
+
+    return toInteger(isSuccess);
+}
+
+auto Database::incr(const std::span<const std::string_view> arguments) -> Reply {
+    return this->crement(arguments.front(), 1, true);
+}
+
+auto Database::incrBy(const std::span<const std::string_view> arguments) -> Reply {
+    const std::optional increment{Entry::parseInteger(arguments[1])};
+    if (!increment.has_value()) return wrongInteger;
+
+    return this->crement(arguments[0], *increment, true);
+}
+
+auto Database::decr(const std::span<const std::string_view> arguments) -> Reply {
+    return this->crement(arguments.front(), 1, false);
+}
+
+auto Database::decrBy(const std::span<const std::string_view> arguments) -> Reply {
+    const std::optional decrement{Entry::parseInteger(arguments[1])};
+    if (!decrement.has_value()) return wrongInteger;
+
+    return this->crement(arguments[0], *decrement, false);
+}
+
+auto Database::append(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size;
+
+    {
+        const auto key{arguments[0]};
+        std::string value{arguments[1]};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::string) {
+                this->update(key, *entry, [&value, &size](std::string &bytes) {
+                    bytes += value;
+                    size = bytes.size();
+                });
+            } else return wrongType;
+        } else {
+            size = value.size();
+            this->insert(key, Entry{std::move(value)});
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::hdel(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        const auto key{arguments.front()};
+        const auto fileds{arguments.subspan(1)};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash) {
+                Hash &hash{entry->getHash()};
+
+                for (const auto filed : fileds) count += hash.erase(filed);
+            } else return wrongType;
+        }
+    }
+
+    return toInteger(count);
+}
+
+auto Database::hexists(const std::span<const std::string_view> arguments) -> Reply {
+    bool isExist{};
+
+    {
+        const auto key{arguments[0]}, field{arguments[1]};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash) {
+                if (entry->getHash().contains(field)) isExist = true;
+            } else return wrongType;
+        }
+    }
+
+    return toInteger(isExist);
+}
+
+auto Database::hget(const std::span<const std::string_view> arguments) -> Reply {
+    std::string value;
+
+    {
+        const auto key{arguments[0]}, field{arguments[1]};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash) {
+                if (const auto result{entry->getHash().find(field)}; result.has_value()) value = *result;
+                else return nil;
+            } else return wrongType;
+        } else return nil;
+    }
+
+    return toBulk(value);
+}
+
+auto Database::hgetAll(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::pair<std::string, std::string>> filedValues;
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr)
+            entry->getHash().traverse([&filedValues](const std::string_view field, const std::string_view value) {
+                filedValues.emplace_back(field, value);
+            });
+    }
+
+    std::vector<Reply> replies;
+    for (auto &[field, value] : filedValues) {
+        replies.emplace_back(toBulk(std::move(field)));
+        replies.emplace_back(toBulk(std::move(value)));
+    }
+
+    return Reply{std::move(replies)};
+}
+
+auto Database::hincrBy(const std::span<const std::string_view> arguments) -> Reply {
+    long number{};
+
+    {
+        const auto key{arguments[0]}, field{arguments[1]};
+
+        const std::optional crement{Entry::parseInteger(arguments[2])};
+        if (!crement.has_value()) return wrongInteger;
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash) {
+                Hash &hash{entry->getHash()};
+
+                number = *crement;
+                if (const auto result{hash.find(field)}; result.has_value()) {
+                    const std::optional oldNumber{Entry::parseInteger(*result)};
+                    if (!oldNumber.has_value()) return wrongInteger;
+                    if (__builtin_add_overflow(*oldNumber, *crement, &number)) return overflow;
+                }
+
+                hash.set(field, std::to_string(number));
+            } else return wrongType;
+        } else {
+            number = *crement;
+
+            Hash hash;
+            hash.set(field, std::to_string(number));
+            this->insert(key, Entry{std::move(hash)});
+        }
+    }
+
+    return toInteger(number);
+}
+
+auto Database::hkeys(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> fileds;
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash)
+                entry->getHash().traverse(
+                    [&fileds](const std::string_view filed, std::string_view) { fileds.emplace_back(filed); });
+            else return wrongType;
+        }
+    }
+
+    return toArray(fileds);
+}
+
+auto Database::hlen(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size{};
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash) size = entry->getHash().size();
+            else return wrongType;
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::hscan(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> elements;
+    unsigned long next{};
+
+    {
+        if (arguments.size() < 2) return syntaxError;
+
+        const std::optional cursor{Entry::parseInteger(arguments[1])};
+        if (!cursor.has_value() || *cursor < 0) return toError("ERR invalid cursor");
+
+        std::string_view pattern{"*"};
+        unsigned long count{10};
+        if (!parseScanOptions(arguments.subspan(2), pattern, count)) return syntaxError;
+
+        const std::string_view key{arguments.front()};
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::hash) return wrongType;
+
+            next = entry->getHash().scan(
+                *cursor, count, [&elements, pattern](const std::string_view field, const std::string_view value) {
+                    if (pattern != "*" && !isMatch(pattern, field)) return;
+
+                    elements.emplace_back(field);
+                    elements.emplace_back(value);
+                });
+        }
+    }
+
+    return toScanResult(std::to_string(next), elements);
+}
+
+auto Database::hset(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.size() % 2 != 1) return toError("ERR wrong number of arguments for 'hset' command");
+
+        const auto key{arguments.front()};
+
+        std::vector<std::pair<std::string_view, std::string_view>> filedValues;
+        for (unsigned long i{1}; i < arguments.size(); i += 2) filedValues.emplace_back(arguments[i], arguments[i + 1]);
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::hash) return wrongType;
+
+            Hash &hash{entry->getHash()};
+            for (const auto &[filed, value] : filedValues) count += hash.set(filed, value);
+        } else {
+            Hash hash;
+            for (const auto &[filed, value] : filedValues) count += hash.set(filed, value);
+
+            this->insert(key, Entry{std::move(hash)});
+        }
+    }
+
+    return toInteger(count);
+}
+
+auto Database::hvals(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> values;
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::hash)
+                entry->getHash().traverse(
+                    [&values](std::string_view, const std::string_view value) { values.emplace_back(value); });
+            else return wrongType;
+        }
+    }
+
+    return toArray(values);
+}
+
+auto Database::lindex(const std::span<const std::string_view> arguments) -> Reply {
+    std::string element;
+
+    {
+        const auto key{arguments[0]};
+
+        const std::optional indexArgument{Entry::parseInteger(arguments[1])};
+        if (!indexArgument.has_value()) return wrongInteger;
+        auto index{*indexArgument};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::list) {
+                const List &list{entry->getList()};
+                const auto listSize{static_cast<decltype(index)>(list.size())};
+
+                index = index < 0 ? listSize + index : index;
+                if (index >= listSize || index < 0) return nil;
+
+                element = list.at(index);
+            } else return wrongType;
+        } else return nil;
+    }
+
+    return toBulk(element);
+}
+
+auto Database::llen(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size{};
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::list) size = entry->getList().size();
+            else return wrongType;
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::lpop(const std::span<const std::string_view> arguments) -> Reply {
+    std::string element;
+
+    {
+        const auto key{arguments.front()};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        Entry *const entry{this->find(key)};
+        if (entry == nullptr) return nil;
+        if (entry->getType() != Entry::Type::list) return wrongType;
+
+        List &list{entry->getList()};
+        element = list.popFront();
+        if (list.size() == 0) this->erase(key);
+    }
+
+    return toBulk(element);
+}
+
+auto Database::lpush(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size;
+
+    {
+        const auto key{arguments.front()};
+        const auto elements{arguments.subspan(1)};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::list) return wrongType;
+
+            List &list{entry->getList()};
+            for (const auto element : elements) list.pushFront(element);
+            size = list.size();
+        } else {
+            List list;
+            for (const auto element : elements) list.pushFront(element);
+            size = list.size();
+
+            this->insert(key, Entry{std::move(list)});
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::lpushx(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size{};
+
+    {
+        const auto key{arguments.front()};
+        const auto elements{arguments.subspan(1)};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::list) {
+                List &list{entry->getList()};
+
+                for (const auto element : elements) list.pushFront(element);
+                size = list.size();
+            } else return wrongType;
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::linsert(const std::span<const std::string_view> arguments) -> Reply {
+    long size{};
+
+    {
+        if (arguments.size() != 4) return syntaxError;
+
+        const bool isBefore{isOption(arguments[1], "BEFORE")};
+        if (!isBefore && !isOption(arguments[1], "AFTER")) return syntaxError;
+
+        const std::lock_guard lockGuard{this->getShard(arguments.front()).lock};
+
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::list) return wrongType;
+
+            if (List & list{entry->getList()}; list.insert(arguments[2], arguments[3], isBefore))
+                size = static_cast<long>(list.size());
+            else size = -1;
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::lrange(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> elements;
+
+    {
+        if (arguments.size() != 3) return syntaxError;
+
+        std::optional start{Entry::parseInteger(arguments[1])}, end{Entry::parseInteger(arguments[2])};
+        if (!start.has_value() || !end.has_value()) return wrongInteger;
+
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
+
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::list) return wrongType;
+
+            if (const List & list{entry->getList()}; normalizeRange(*start, *end, list.size()))
+                list.range(*start, *end,
+                           [&elements](const std::string_view element) { elements.emplace_back(element); });
+        }
+    }
+
+    return toArray(elements);
+}
+
+auto Database::lrem(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.size() != 3) return syntaxError;
+
+        const std::optional limit{Entry::parseInteger(arguments[1])};
+        if (!limit.has_value()) return wrongInteger;
+
+        const std::lock_guard lockGuard{this->getShard(arguments.front()).lock};
+
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::list) return wrongType;
+
+            List &list{entry->getList()};
+            count = list.remove(arguments[2], *limit);
+            if (list.size() == 0) this->erase(arguments.front());
+        }
+    }
+
+    return toInteger(count);
+}
+
+auto Database::lset(const std::span<const std::string_view> arguments) -> Reply {
+    {
+        if (arguments.size() != 3) return syntaxError;
+
+        std::optional index{Entry::parseInteger(arguments[1])};
+        if (!index.has_value()) return wrongInteger;
+
+        const std::lock_guard lockGuard{this->getShard(arguments.front()).lock};
+
+        Entry *const entry{this->find(arguments.front())};
+        if (entry == nullptr) return toError("ERR no such key");
+        if (entry->getType() != Entry::Type::list) return wrongType;
+
+        List &list{entry->getList()};
+        const auto size{static_cast<long>(list.size())};
+
+        if (*index < 0) *index += size;
+        if (*index < 0 || *index >= size) return toError("ERR index out of range");
+
+        list.set(*index, arguments[2]);
+    }
+
+    return ok;
+}
+
+auto Database::ltrim(const std::span<const std::string_view> arguments) -> Reply {
+    {
+        if (arguments.size() != 3) return syntaxError;
+
+        std::optional start{Entry::parseInteger(arguments[1])}, end{Entry::parseInteger(arguments[2])};
+        if (!start.has_value() || !end.has_value()) return wrongInteger;
+
+        const std::lock_guard lockGuard{this->getShard(arguments.front()).lock};
+
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::list) return wrongType;
+
+            if (List & list{entry->getList()}; normalizeRange(*start, *end, list.size())) list.trim(*start, *end);
+            else this->erase(arguments.front());
+        }
+    }
+
+    return ok;
+}
+
+auto Database::rpop(const std::span<const std::string_view> arguments) -> Reply {
+    std::string element;
+
+    {
+        const auto key{arguments.front()};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        Entry *const entry{this->find(key)};
+        if (entry == nullptr) return nil;
+        if (entry->getType() != Entry::Type::list) return wrongType;
+
+        List &list{entry->getList()};
+        element = list.popBack();
+        if (list.size() == 0) this->erase(key);
+    }
+
+    return toBulk(element);
+}
+
+auto Database::rpush(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size;
+
+    {
+        if (arguments.size() < 2) return syntaxError;
+
+        const std::string_view key{arguments.front()};
+        const std::span elements{arguments.subspan(1)};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::list) return wrongType;
+
+            List &list{entry->getList()};
+            for (const auto element : elements) list.pushBack(element);
+            size = list.size();
+        } else {
+            List list;
+            for (const auto element : elements) list.pushBack(element);
+            size = list.size();
+
+            this->insert(key, Entry{std::move(list)});
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::sadd(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.size() < 2) return syntaxError;
+
+        const std::string_view key{arguments.front()};
+        const std::span members{arguments.subspan(1)};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::set) return wrongType;
+
+            Set &set{entry->getSet()};
+            for (const auto member : members) count += set.insert(member);
+        } else {
+            Set set;
+            for (const auto member : members) count += set.insert(member);
+
+            this->insert(key, Entry{std::move(set)});
+        }
+    }
+
+    return toInteger(count);
+}
+
+auto Database::scard(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long size{};
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::set) size = entry->getSet().size();
+            else return wrongType;
+        }
+    }
+
+    return toInteger(size);
+}
+
+auto Database::sdiff(const std::span<const std::string_view> arguments) -> Reply {
+    return this->combine(arguments, Set::difference);
+}
+
+auto Database::sinter(const std::span<const std::string_view> arguments) -> Reply {
+    return this->combine(arguments, Set::intersect);
+}
+
+auto Database::sinterCard(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.empty()) return syntaxError;
+
+        const std::optional keyCount{Entry::parseInteger(arguments.front())};
+        if (!keyCount.has_value() || *keyCount <= 0) return toError("ERR numkeys should be greater than 0");
+        std::span keys{arguments.subspan(1)};
+
+        unsigned long limit{};
+        if (keys.size() == static_cast<unsigned long>(*keyCount) + 2 && isOption(keys[*keyCount], "LIMIT")) {
+            const std::optional result{Entry::parseInteger(keys.back())};
+            if (!result.has_value() || *result < 0) return toError("ERR LIMIT can't be negative");
+
+            limit = *result;
+            keys = keys.first(*keyCount);
+        }
+        if (keys.size() != static_cast<unsigned long>(*keyCount)) return syntaxError;
+
+        const std::vector sharedLocks{this->lockShared(keys)};
+
+        std::vector<const Set *> sets;
+        for (const auto key : keys) {
+            Entry *const entry{this->find(key)};
+            if (entry == nullptr) return toInteger(0);
+            if (entry->getType() != Entry::Type::set) return wrongType;
+
+            sets.emplace_back(&entry->getSet());
+        }
+
+        count = Set::intersectCount(sets, limit);
+    }
+
+    return toInteger(count);
+}
+
+auto Database::sismember(const std::span<const std::string_view> arguments) -> Reply {
+    bool isMember{};
+
+    {
+        const auto key{arguments[0]}, member{arguments[1]};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::set) isMember = entry->getSet().contains(member);
+            else return wrongType;
+        }
+    }
+
+    return toInteger(isMember);
+}
+
+auto Database::smembers(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> members;
+
+    {
+        const auto key{arguments.front()};
+
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::set)
+                entry->getSet().traverse([&members](const std::string_view member) { members.emplace_back(member); });
+            else return wrongType;
+        }
+    }
+
+    return toArray(members);
+}
+
+auto Database::srem(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.size() < 2) return syntaxError;
+
+        const std::string_view key{arguments.front()};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::set) return wrongType;
+
+            Set &set{entry->getSet()};
+            for (const auto member : arguments.subspan(1)) count += set.erase(member);
+            if (set.size() == 0) this->erase(key);
+        }
+    }
+
+    return toInteger(count);
+}
+
+auto Database::sscan(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> elements;
+    unsigned long next{};
+
+    {
+        if (arguments.size() < 2) return syntaxError;
+
+        const std::optional cursor{Entry::parseInteger(arguments[1])};
+        if (!cursor.has_value() || *cursor < 0) return toError("ERR invalid cursor");
+
+        std::string_view pattern{"*"};
+        unsigned long count{10};
+        if (!parseScanOptions(arguments.subspan(2), pattern, count)) return syntaxError;
+
+        const std::string_view key{arguments.front()};
+        const std::shared_lock sharedLock{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::set) return wrongType;
+
+            next = entry->getSet().scan(*cursor, count, [&elements, pattern](const std::string_view element) {
+                if (pattern == "*" || isMatch(pattern, element)) elements.emplace_back(element);
+            });
+        }
+    }
+
+    return toScanResult(std::to_string(next), elements);
+}
+
+auto Database::sunion(const std::span<const std::string_view> arguments) -> Reply {
+    return this->combine(arguments, Set::unite);
+}
+
+auto Database::zadd(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
+
+    {
+        if (arguments.size() < 3 || arguments.size() % 2 == 0) return syntaxError;
+
+        const std::string_view key{arguments.front()};
+        std::vector<std::pair<std::string_view, double>> memberScores;
+        for (unsigned long i{1}; i < arguments.size(); i += 2) {
+            const std::optional score{SortedSet::parseScore(arguments[i])};
+            if (!score.has_value()) return wrongFloat;
+
+            memberScores.emplace_back(arguments[i + 1], *score);
+        }
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
 
-        const std::shared_lock sharedLock{this->lock};
+            SortedSet &sortedSet{entry->getSortedSet()};
+            for (const auto &[member, score] : memberScores) count += sortedSet.insert(member, score);
+        } else {
+            SortedSet sortedSet;
+            for (const auto &[member, score] : memberScores) count += sortedSet.insert(member, score);
 
-        for (const auto key : keys)
-            if (this->skiplist.find(key) != nullptr) ++count;
+            this->insert(key, Entry{std::move(sortedSet)});
+        }
     }
 
-    return integer + std::to_string(count);
+    return toInteger(count);
 }
 
-auto Database::move(std::unordered_map<unsigned long, Database> &databases, const std::string_view statement)
-    -> std::string {
-    bool isSuccess{};
+auto Database::zcount(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
 
     {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
+        if (arguments.size() != 3) return syntaxError;
 
-        if (const auto targetResult{databases.find(std::stoul(std::string{statement.substr(space + 1)}))};
-            targetResult != databases.cend()) {
-            Database &target{targetResult->second};
-
-            const std::scoped_lock scopedLock{this->lock, target.lock};
+        const std::optional min{SortedSet::parseBound(arguments[1])}, max{SortedSet::parseBound(arguments[2])};
+        if (!min.has_value() || !max.has_value()) return wrongBound;
 
-            if (std::shared_ptr entry{this->skiplist.find(key)};
-                entry != nullptr && target.skiplist.find(key) == nullptr) {
-                this->skiplist.erase(key);
-                target.skiplist.insert(std::move(entry));
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
 
-                isSuccess = true;
-            }
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() == Entry::Type::sortedSet) count = entry->getSortedSet().count(*min, *max);
+            else return wrongType;
         }
     }
 
-    return integer + std::to_string(isSuccess);
+    return toInteger(count);
 }
 
-auto Database::rename(const std::string_view statement) -> std::string {
-    const unsigned long space{statement.find(' ')};
-    const auto key{statement.substr(0, space)}, newKey{statement.substr(space + 1)};
+auto Database::zincrBy(const std::span<const std::string_view> arguments) -> Reply {
+    double score;
+
+    {
+        if (arguments.size() != 3) return syntaxError;
 
-    const std::lock_guard lockGuard{this->lock};
+        const std::string_view key{arguments.front()}, member{arguments[2]};
+        const std::optional increment{SortedSet::parseScore(arguments[1])};
+        if (!increment.has_value()) return wrongFloat;
 
-    if (std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-        this->skiplist.erase(key);
+        const std::lock_guard lockGuard{this->getShard(key).lock};
 
-        entry->getKey() = newKey;
-        this->skiplist.insert(std::move(entry));
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
 
-        return ok;
+            SortedSet &sortedSet{entry->getSortedSet()};
+            score = sortedSet.score(member).value_or(0) + *increment;
+            if (SortedSet::isNan(score)) return toError("ERR resulting score is not a number (NaN)");
+
+            sortedSet.insert(member, score);
+        } else {
+            score = *increment;
+
+            SortedSet sortedSet;
+            sortedSet.insert(member, score);
+            this->insert(key, Entry{std::move(sortedSet)});
+        }
     }
 
-    return "(error) ERR no such key";
+    return toBulk(SortedSet::formatScore(score));
 }
 
-auto Database::renamenx(const std::string_view statement) -> std::string {
-    bool isSuccess{};
+auto Database::zrange(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> elements;
 
     {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)}, newKey{statement.substr(space + 1)};
+        const bool isWithScores{arguments.size() == 4 && isOption(arguments[3], "WITHSCORES")};
+        if (arguments.size() != 3 && !isWithScores) return syntaxError;
 
-        const std::lock_guard lockGuard{this->lock};
+        std::optional start{Entry::parseInteger(arguments[1])}, end{Entry::parseInteger(arguments[2])};
+        if (!start.has_value() || !end.has_value()) return wrongInteger;
 
-        if (std::shared_ptr entry{this->skiplist.find(key)};
-            entry != nullptr && this->skiplist.find(newKey) == nullptr) {
-            this->skiplist.erase(key);
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
 
-            entry->getKey() = newKey;
-            this->skiplist.insert(std::move(entry));
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
 
-            isSuccess = true;
+            if (const SortedSet & sortedSet{entry->getSortedSet()}; normalizeRange(*start, *end, sortedSet.size()))
+                sortedSet.range(*start, *end,
+                                [&elements, isWithScores](const std::string_view member, const double score) {
+                                    elements.emplace_back(member);
+                                    if (isWithScores) elements.emplace_back(SortedSet::formatScore(score));
+                                });
         }
     }
 
-    return integer + std::to_string(isSuccess);
+    return toArray(elements);
 }
 
-auto Database::type(const std::string_view statement) -> std::string {
-    const std::shared_lock sharedLock{this->lock};
+auto Database::zrangeByScore(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<std::string> elements;
 
-    if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-        switch (entry->getType()) {
-            case Entry::Type::string:
-                return "string";
-            case Entry::Type::hash:
-                return "hash";
-            case Entry::Type::list:
-                return "list";
-            case Entry::Type::set:
-                return "set";
-            case Entry::Type::sortedSet:
-                return "zset";
-        }
-    }
+    {
+        const bool isWithScores{arguments.size() == 4 && isOption(arguments[3], "WITHSCORES")};
+        if (arguments.size() != 3 && !isWithScores) return syntaxError;
 
-    return "none";
-}
+        const std::optional min{SortedSet::parseBound(arguments[1])}, max{SortedSet::parseBound(arguments[2])};
+        if (!min.has_value() || !max.has_value()) return wrongBound;
 
-auto Database::set(const std::string_view statement) -> std::string {
-    {
-        const unsigned long space{statement.find(' ')};
-        std::string key{statement.substr(0, space)}, value{statement.substr(space + 1)};
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
 
-        const std::lock_guard lockGuard{this->lock};
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
 
-        this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(value)));
+            entry->getSortedSet().rangeByScore(
+                *min, *max, [&elements, isWithScores](const std::string_view member, const double score) {
+                    elements.emplace_back(member);
+                    if (isWithScores) elements.emplace_back(SortedSet::formatScore(score));
+                });
+        }
     }
 
-    return ok;
+    return toArray(elements);
 }
 
-auto Database::get(const std::string_view statement) -> std::string {
-    std::string value;
+auto Database::zrank(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long rank;
 
     {
-        const std::shared_lock sharedLock{this->lock};
+        if (arguments.size() != 2) return syntaxError;
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) value = entry->getString();
-            else return wrongType;
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
+
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
+
+            if (const std::optional result{entry->getSortedSet().rank(arguments[1])}; result.has_value())
+                rank = *result;
+            else return nil;
         } else return nil;
     }
 
-    return '"' + value + '"';
+    return toInteger(rank);
 }
 
-auto Database::getRange(std::string_view statement) -> std::string {
-    unsigned long space{statement.find(' ')};
-    const auto key{statement.substr(0, space)};
-    statement.remove_prefix(space + 1);
-
-    space = statement.find(' ');
-    auto start{std::stol(std::string{statement.substr(0, space)})},
-        end{std::stol(std::string{statement.substr(space + 1)})};
-
-    std::string result;
+auto Database::zrem(const std::span<const std::string_view> arguments) -> Reply {
+    unsigned long count{};
 
     {
-        const std::shared_lock sharedLock{this->lock};
+        if (arguments.size() < 2) return syntaxError;
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            const auto entryValueSize{static_cast<decltype(start)>(entry->getString().size())};
+        const std::string_view key{arguments.front()};
 
-            start = start < 0 ? entryValueSize + start : start;
-            if (start < 0) start = 0;
+        const std::lock_guard lockGuard{this->getShard(key).lock};
 
-            end = end < 0 ? entryValueSize + end : end;
-            ++end;
-            if (end > entryValueSize) end = entryValueSize;
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
 
-            if (start < entryValueSize && end > 0 && start < end)
-                result = entry->getString().substr(start, end - start);
+            SortedSet &sortedSet{entry->getSortedSet()};
+            for (const auto member : arguments.subspan(1)) count += sortedSet.erase(member);
+            if (sortedSet.size() == 0) this->erase(key);
         }
     }
 
-    return '"' + result + '"';
+    return toInteger(count);
 }
 
-auto Database::getBit(const std::string_view statement) -> std::string {
-    bool bit{};
+auto Database::zscore(const std::span<const std::string_view> arguments) -> Reply {
+    double score;
 
     {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        const auto offset{std::stoul(std::string{statement.substr(space + 1)})};
+        if (arguments.size() != 2) return syntaxError;
 
-        const std::shared_lock sharedLock{this->lock};
+        const std::shared_lock sharedLock{this->getShard(arguments.front()).lock};
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) {
-                if (const unsigned long index{offset / 8}; index < entry->getString().size())
-                    bit = entry->getString()[index] >> offset % 8 & 1;
-            } else return wrongType;
-        }
+        if (Entry *const entry{this->find(arguments.front())}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::sortedSet) return wrongType;
+
+            if (const std::optional result{entry->getSortedSet().score(arguments[1])}; result.has_value())
+                score = *result;
+            else return nil;
+        } else return nil;
     }
 
-    return integer + std::to_string(bit);
+    return toBulk(SortedSet::formatScore(score));
 }
 
-auto Database::mget(const std::string_view statement) -> std::string {
-    std::vector<std::string> values;
+auto Database::pfAdd(const std::span<const std::string_view> arguments) -> Reply {
+    bool isChanged{};
 
     {
-        std::vector<std::string_view> keys;
-        for (const auto &view : statement | std::views::split(' ')) keys.emplace_back(view);
+        const auto key{arguments.front()};
 
-        const std::shared_lock sharedLock{this->lock};
+        const std::lock_guard lockGuard{this->getShard(key).lock};
 
-        for (const auto key : keys) {
-            if (const std::shared_ptr entry{this->skiplist.find(key)};
-                entry != nullptr && entry->getType() == Entry::Type::string)
-                values.emplace_back(entry->getString());
-            else values.emplace_back();
-        }
-    }
+        Entry *entry{this->find(key)};
+        if (entry == nullptr) {
+            this->insert(key, Entry{HyperLogLog{}});
+            entry = this->find(key);
 
-    std::string result;
-    unsigned long index{};
-    for (const auto &value : values) {
-        result += std::to_string(++index) + ") ";
+            isChanged = true;
+        } else if (entry->getType() != Entry::Type::hyperLogLog) return wrongType;
 
-        if (!value.empty()) result += '"' + value + '"' + '\n';
-        else result += nil + '\n';
+        HyperLogLog &hyperLogLog{entry->getHyperLogLog()};
+        for (const auto element : arguments.subspan(1)) isChanged |= hyperLogLog.add(element);
     }
-    result.pop_back();
 
-    return result;
+    return toInteger(isChanged);
 }
 
-auto Database::setBit(std::string_view statement) -> std::string {
-    bool oldBit{};
+auto Database::pfCount(const std::span<const std::string_view> keys) -> Reply {
+    unsigned long count;
 
     {
-        unsigned long space{statement.find(' ')};
-        std::string key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
+        const std::vector sharedLocks{this->lockShared(keys)};
 
-        space = statement.find(' ');
-        const auto offset{std::stoul(std::string{statement.substr(0, space)})}, index{offset / 8};
-        const auto position{static_cast<unsigned char>(offset % 8)};
-        const auto value{statement.substr(space + 1) == "1"};
+        std::vector<const HyperLogLog *> hyperLogLogs;
+        for (const auto key : keys) {
+            if (Entry *const entry{this->find(key)}; entry != nullptr) {
+                if (entry->getType() != Entry::Type::hyperLogLog) return wrongType;
 
-        const std::lock_guard lockGuard{this->lock};
+                hyperLogLogs.emplace_back(&entry->getHyperLogLog());
+            }
+        }
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) {
-                std::string &entryValue{entry->getString()};
+        count = HyperLogLog::count(hyperLogLogs);
+    }
 
-                if (index >= entryValue.size()) entryValue.resize(index + 1);
+    return toInteger(count);
+}
 
-                char &element{entryValue[index]};
-                oldBit = element >> position & 1;
+auto Database::pfMerge(const std::span<const std::string_view> keys) -> Reply {
+    const std::vector lockGuards{this->lock(keys)};
 
-                if (value) element = static_cast<char>(element | 1 << position);
-                else element = static_cast<char>(element & ~(1 << position));
-            } else return wrongType;
-        } else {
-            std::string newValue(index + 1, 0);
-            if (char &element{newValue[index]}; value) element = static_cast<char>(element | 1 << position);
+    std::vector<const HyperLogLog *> hyperLogLogs;
+    for (const auto key : keys) {
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::hyperLogLog) return wrongType;
 
-            this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(newValue)));
+            hyperLogLogs.emplace_back(&entry->getHyperLogLog());
         }
     }
 
-    return integer + std::to_string(oldBit);
+    HyperLogLog result{HyperLogLog::merge(hyperLogLogs)};
+    if (Entry *const entry{this->find(keys.front())}; entry != nullptr) entry->getHyperLogLog() = std::move(result);
+    else this->insert(keys.front(), Entry{std::move(result)});
+
+    return ok;
 }
 
-auto Database::setnx(const std::string_view statement) -> std::string {
-    bool isSuccess{};
+auto Database::bfReserve(const std::span<const std::string_view> arguments) -> Reply {
+    if (arguments.size() < 3) return syntaxError;
 
-    {
-        const unsigned long space{statement.find(' ')};
-        std::string key{statement.substr(0, space)}, value{statement.substr(space + 1)};
+    const std::optional errorRate{SortedSet::parseScore(arguments[1])};
+    if (!errorRate.has_value() || *errorRate <= 0 || *errorRate >= 1) return toError("ERR (0 < error rate range < 1)");
 
-        const std::lock_guard lockGuard{this->lock};
+    const std::optional capacity{Entry::parseInteger(arguments[2])};
+    if (!capacity.has_value() || *capacity <= 0) return toError("ERR (capacity should be larger than 0)");
+    if (!BloomFilter::isCreatable(*errorRate, *capacity)) return toError("ERR filter is too large");
 
-        if (this->skiplist.find(key) == nullptr) {
-            this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(value)));
+    unsigned long expansion{BloomFilter::defaultExpansion};
+    for (unsigned long i{3}; i < arguments.size(); ++i) {
+        if (isOption(arguments[i], "NONSCALING")) expansion = 0;
+        else if (isOption(arguments[i], "EXPANSION") && i + 1 < arguments.size()) {
+            const std::optional result{Entry::parseInteger(arguments[++i])};
+            if (!result.has_value() || *result < 1) return toError("ERR expansion should be greater or equal to 1");
 
-            isSuccess = true;
-        }
+            expansion = *result;
+        } else return syntaxError;
     }
 
-    return integer + std::to_string(isSuccess);
-}
+    const std::lock_guard lockGuard{this->getShard(arguments.front()).lock};
 
-auto Database::setRange(std::string_view statement) -> std::string {
-    unsigned long size;
+    if (this->find(arguments.front()) != nullptr) return toError("ERR item exists");
 
-    {
-        unsigned long space{statement.find(' ')};
-        std::string key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
+    this->insert(arguments.front(), Entry{BloomFilter{*errorRate, static_cast<unsigned long>(*capacity), expansion}});
 
-        space = statement.find(' ');
-        const auto offset{std::stoul(std::string{statement.substr(0, space)})};
-        const auto value{statement.substr(space + 1)};
+    return ok;
+}
 
-        const unsigned long end{offset + value.size()};
+auto Database::bfAdd(const std::span<const std::string_view> arguments) -> Reply {
+    return this->addToBloomFilter(arguments, false);
+}
 
-        const std::lock_guard lockGuard{this->lock};
+auto Database::bfMadd(const std::span<const std::string_view> arguments) -> Reply {
+    return this->addToBloomFilter(arguments, true);
+}
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) {
-                std::string &entryValue{entry->getString()};
-                const unsigned long oldEnd{entryValue.size()};
+auto Database::bfExists(const std::span<const std::string_view> arguments) -> Reply {
+    return this->findInBloomFilter(arguments, false);
+}
 
-                if (end > oldEnd) entryValue.resize(end);
-                if (offset > oldEnd) entryValue.replace(oldEnd, offset - oldEnd, offset - oldEnd, '\0');
+auto Database::bfMexists(const std::span<const std::string_view> arguments) -> Reply {
+    return this->findInBloomFilter(arguments, true);
+}
 
-                entryValue.replace(offset, value.size(), value);
-                size = entryValue.size();
-            } else return wrongType;
-        } else {
-            std::string newValue{std::string(offset, '\0') + std::string{value}};
-            size = newValue.size();
+auto Database::cmsInitByDim(const std::span<const std::string_view> arguments) -> Reply {
+    if (arguments.size() != 3) return syntaxError;
 
-            this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(newValue)));
-        }
-    }
+    const std::optional width{Entry::parseInteger(arguments[1])}, depth{Entry::parseInteger(arguments[2])};
+    if (!width.has_value() || !depth.has_value() || *width <= 0 || *depth <= 0)
+        return toError("CMS: invalid width/depth");
 
-    return integer + std::to_string(size);
+    return this->reserveCountMinSketch(arguments.front(), *width, *depth);
 }
 
-auto Database::strlen(const std::string_view statement) -> std::string {
-    unsigned long size{};
+auto Database::cmsInitByProb(const std::span<const std::string_view> arguments) -> Reply {
+    if (arguments.size() != 3) return syntaxError;
 
-    {
-        const std::shared_lock sharedLock{this->lock};
+    const std::optional error{SortedSet::parseScore(arguments[1])};
+    if (!error.has_value() || *error <= 0 || *error >= 1) return toError("CMS: invalid overestimation value");
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) size = entry->getString().size();
-            else return wrongType;
-        }
-    }
+    const std::optional probability{SortedSet::parseScore(arguments[2])};
+    if (!probability.has_value() || *probability <= 0 || *probability >= 1) return toError("CMS: invalid prob value");
 
-    return integer + std::to_string(size);
+    const auto [width, depth]{CountMinSketch::getDimensions(*error, *probability)};
+
+    return this->reserveCountMinSketch(arguments.front(), width, depth);
 }
 
-auto Database::mset(std::string_view statement) -> std::string {
+auto Database::cmsIncrBy(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<Reply> replies;
+
     {
-        std::vector<std::pair<std::string, std::string>> keyValues;
-        while (!statement.empty()) {
-            unsigned long space{statement.find(' ')};
-            const auto key{statement.substr(0, space)};
-            statement.remove_prefix(space + 1);
+        if (arguments.size() < 3 || arguments.size() % 2 == 0) return syntaxError;
 
-            space = statement.find(' ');
-            std::string_view value;
-            if (space != std::string_view::npos) {
-                value = statement.substr(0, space);
-                statement.remove_prefix(space + 1);
-            } else {
-                value = statement;
-                statement = {};
-            }
+        std::vector<unsigned int> increments;
+        for (unsigned long i{2}; i < arguments.size(); i += 2) {
+            const std::optional increment{Entry::parseInteger(arguments[i])};
+            if (!increment.has_value() || *increment < 0 || *increment > std::numeric_limits<unsigned int>::max())
+                return toError("CMS: Cannot parse number");
 
-            keyValues.emplace_back(key, value);
+            increments.emplace_back(static_cast<unsigned int>(*increment));
         }
 
-        const std::lock_guard lockGuard{this->lock};
+        const auto key{arguments.front()};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
 
-        for (auto &[key, value] : keyValues)
-            this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(value)));
+        Entry *const entry{this->find(key)};
+        if (entry == nullptr) return toError("CMS: key does not exist");
+        if (entry->getType() != Entry::Type::countMinSketch) return wrongType;
+
+        CountMinSketch &countMinSketch{entry->getCountMinSketch()};
+        for (unsigned long i{}; i < increments.size(); ++i)
+            replies.emplace_back(toInteger(countMinSketch.increment(arguments[i * 2 + 1], increments[i])));
     }
 
-    return ok;
+    return Reply{std::move(replies)};
 }
 
-auto Database::msetnx(std::string_view statement) -> std::string {
-    std::vector<std::pair<std::string, std::string>> keyValues;
+auto Database::cmsQuery(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<Reply> replies;
 
     {
-        while (!statement.empty()) {
-            unsigned long space{statement.find(' ')};
-            const auto key{statement.substr(0, space)};
-            statement.remove_prefix(space + 1);
-
-            space = statement.find(' ');
-            std::string_view value;
-            if (space != std::string_view::npos) {
-                value = statement.substr(0, space);
-                statement.remove_prefix(space + 1);
-            } else {
-                value = statement;
-                statement = {};
-            }
+        if (arguments.size() < 2) return syntaxError;
 
-            keyValues.emplace_back(key, value);
-        }
-
-        const std::lock_guard lockGuard{this->lock};
+        const auto key{arguments.front()};
 
-        for (const std::string_view key : keyValues | std::views::keys) {
-            if (this->skiplist.find(key) != nullptr) {
-                keyValues.clear();
+        const std::shared_lock sharedLock{this->getShard(key).lock};
 
-                break;
-            }
-        }
+        Entry *const entry{this->find(key)};
+        if (entry == nullptr) return toError("CMS: key does not exist");
+        if (entry->getType() != Entry::Type::countMinSketch) return wrongType;
 
-        for (auto &[key, value] : keyValues)
-            this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(value)));
+        const CountMinSketch &countMinSketch{entry->getCountMinSketch()};
+        for (const auto element : arguments.subspan(1))
+            replies.emplace_back(toInteger(countMinSketch.query(element)));
     }
 
-    return integer + std::to_string(keyValues.size());
+    return Reply{std::move(replies)};
 }
 
-auto Database::incr(const std::string_view statement) -> std::string { return this->crement(statement, 1, true); }
+auto Database::topkReserve(const std::span<const std::string_view> arguments) -> Reply {
+    if (arguments.size() != 2 && arguments.size() != 5) return syntaxError;
 
-auto Database::incrBy(const std::string_view statement) -> std::string {
-    const unsigned long space{statement.find(' ')};
-    const auto key{statement.substr(0, space)};
-    const auto increment{std::stol(std::string{statement.substr(space + 1)})};
+    const std::optional k{Entry::parseInteger(arguments[1])};
+    if (!k.has_value() || *k <= 0) return toError("TopK: invalid k");
 
-    return this->crement(key, increment, true);
-}
+    long width{TopK::defaultWidth}, depth{TopK::defaultDepth};
+    double decay{TopK::defaultDecay};
+    if (arguments.size() == 5) {
+        const std::optional widthResult{Entry::parseInteger(arguments[2])},
+            depthResult{Entry::parseInteger(arguments[3])};
+        if (!widthResult.has_value() || !depthResult.has_value() || *widthResult <= 0 || *depthResult <= 0)
+            return toError("TopK: invalid width/depth");
+
+        const std::optional decayResult{SortedSet::parseScore(arguments[4])};
+        if (!decayResult.has_value() || *decayResult <= 0 || *decayResult > 1) return toError("TopK: invalid decay");
+
+        width = *widthResult;
+        depth = *depthResult;
+        decay = *decayResult;
+    }
+    if (!TopK::isCreatable(*k, width, depth)) return toError("TopK: filter is too large");
 
-auto Database::decr(const std::string_view statement) -> std::string { return this->crement(statement, 1, false); }
+    const std::lock_guard lockGuard{this->getShard(arguments.front()).lock};
 
-auto Database::decrBy(const std::string_view statement) -> std::string {
-    const unsigned long space{statement.find(' ')};
-    const auto key{statement.substr(0, space)};
-    const auto increment{std::stol(std::string{statement.substr(space + 1)})};
+    if (this->find(arguments.front()) != nullptr) return toError("TopK: key already exists");
 
-    return this->crement(key, increment, false);
+    this->insert(arguments.front(), Entry{TopK{static_cast<unsigned int>(*k), static_cast<unsigned int>(width),
+                                            static_cast<unsigned int>(depth), decay}});
+
+    return ok;
 }
 
-auto Database::append(const std::string_view statement) -> std::string {
-    unsigned long size;
+auto Database::topkAdd(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<Reply> replies;
 
     {
-        const unsigned long space{statement.find(' ')};
-        std::string key{statement.substr(0, space)}, value{statement.substr(space + 1)};
+        if (arguments.size() < 2) return syntaxError;
 
-        const std::lock_guard lockGuard{this->lock};
+        const auto key{arguments.front()};
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) {
-                std::string &entryValue{entry->getString()};
+        const std::lock_guard lockGuard{this->getShard(key).lock};
 
-                entryValue += value;
-                size = entryValue.size();
-            } else return wrongType;
-        } else {
-            size = value.size();
-            this->skiplist.insert(std::make_shared<Entry>(std::move(key), std::move(value)));
+        Entry *const entry{this->find(key)};
+        if (entry == nullptr) return toError("TopK: key does not exist");
+        if (entry->getType() != Entry::Type::topK) return wrongType;
+
+        TopK &topK{entry->getTopK()};
+        for (const auto element : arguments.subspan(1)) {
+            if (const std::optional expelled{topK.add(element)}; expelled.has_value())
+                replies.emplace_back(toBulk(*expelled));
+            else replies.emplace_back(nil);
         }
     }
 
-    return integer + std::to_string(size);
+    return Reply{std::move(replies)};
 }
 
-auto Database::hdel(std::string_view statement) -> std::string {
-    unsigned long count{};
+auto Database::topkList(const std::span<const std::string_view> arguments) -> Reply {
+    std::vector<Reply> replies;
 
     {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
+        if (arguments.size() > 2 || (arguments.size() == 2 && !isOption(arguments[1], "WITHCOUNT"))) return syntaxError;
 
-        std::vector<std::string> fileds;
-        for (const auto &view : statement | std::views::split(' ')) fileds.emplace_back(std::string_view{view});
+        const auto key{arguments.front()};
 
-        const std::lock_guard lockGuard{this->lock};
+        const std::shared_lock sharedLock{this->getShard(key).lock};
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash) {
-                std::unordered_map<std::string, std::string> &hash{entry->getHash()};
+        Entry *const entry{this->find(key)};
+        if (entry == nullptr) return toError("TopK: key does not exist");
+        if (entry->getType() != Entry::Type::topK) return wrongType;
 
-                for (const auto &filed : fileds) count += hash.erase(filed);
-            } else return wrongType;
+        for (const auto &[element, count] : entry->getTopK().list()) {
+            replies.emplace_back(toBulk(element));
+            if (arguments.size() == 2) replies.emplace_back(toInteger(count));
         }
     }
 
-    return integer + std::to_string(count);
+    return Reply{std::move(replies)};
 }
 
-auto Database::hexists(const std::string_view statement) -> std::string {
-    bool isExist{};
-
-    {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        const std::string field{statement.substr(space + 1)};
+auto Database::collect(const std::string_view start, const bool isExclusive,
+                       const std::function<auto(std::string_view key)->bool> &isInRange, const unsigned long count)
+    -> std::pair<std::vector<std::string>, std::optional<std::string>> {
+    std::vector<std::string> keys;
+    std::optional<std::string> next;
+
+    const Epoch::Guard guard;
+
+    const auto isGreater{[](const Node *const left, const Node *const right) {
+        return left->getKey() > right->getKey();
+    }};
+    std::vector<Node *> heads;
+    for (const Shard &shard : this->shards) {
+        Node *head{shard.skiplist.lowerBound(start)};
+        if (head != nullptr && isExclusive && head->getKey() == start) head = Skiplist::getNext(head);
+        if (head != nullptr && isInRange(head->getKey())) heads.emplace_back(head);
+    }
+    std::ranges::make_heap(heads, isGreater);
 
-        const std::shared_lock sharedLock{this->lock};
+    const long now{getTime()};
+    std::string_view last;
+    for (unsigned long examinedCount{}; !heads.empty(); ++examinedCount) {
+        if (examinedCount == count) {
+            next = last;
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash) {
-                if (entry->getHash().contains(field)) isExist = true;
-            } else return wrongType;
+            break;
         }
+
+        std::ranges::pop_heap(heads, isGreater);
+        Node *const node{heads.back()};
+        last = node->getKey();
+        if (const long expiration{node->getEntry().getExpiration()}; expiration == 0 || expiration > now)
+            keys.emplace_back(last);
+
+        if (Node *const successor{Skiplist::getNext(node)}; successor != nullptr && isInRange(successor->getKey())) {
+            heads.back() = successor;
+            std::ranges::push_heap(heads, isGreater);
+        } else heads.pop_back();
     }
 
-    return integer + std::to_string(isExist);
+    return {std::move(keys), std::move(next)};
 }
 
-auto Database::hget(const std::string_view statement) -> std::string {
-    std::string value;
+auto Database::setDeadline(const std::span<const std::string_view> arguments, const std::string_view unit)
+    -> Reply {
+    bool isSet{};
 
     {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        const std::string field{statement.substr(space + 1)};
+        if (arguments.size() != 2) return syntaxError;
 
-        const std::shared_lock sharedLock{this->lock};
+        const std::string_view key{arguments.front()};
+        const std::optional time{Entry::parseInteger(arguments[1])};
+        if (!time.has_value()) return wrongInteger;
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash) {
-                const std::unordered_map<std::string, std::string> &hash{entry->getHash()};
+        const std::optional deadline{getDeadline(unit, *time)};
+        if (!deadline.has_value()) return toError("ERR invalid expire time in 'expire' command");
 
-                if (const auto result{hash.find(field)}; result != hash.cend()) value = result->second;
-                else return nil;
-            } else return wrongType;
-        } else return nil;
+        Shard &shard{this->getShard(key)};
+        const std::lock_guard lockGuard{shard.lock};
+
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (*deadline <= getTime()) this->erase(key);
+            else {
+                entry->setExpiration(*deadline);
+                shard.volatileKeys.emplace(key);
+            }
+
+            isSet = true;
+        }
     }
 
-    return '"' + value + '"';
+    return toInteger(isSet);
 }
 
-auto Database::hgetAll(const std::string_view statement) -> std::string {
-    std::vector<std::pair<std::string, std::string>> filedValues;
+auto Database::getRemaining(const std::string_view key, const bool isMillisecond) -> Reply {
+    long remaining;
 
     {
-        const std::shared_lock sharedLock{this->lock};
-
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr)
-            for (const auto &[field, value] : entry->getHash()) filedValues.emplace_back(field, value);
-    }
+        const std::shared_lock sharedLock{this->getShard(key).lock};
 
-    std::string result;
-    unsigned long index{};
-    for (const auto &[field, value] : filedValues) {
-        result += std::to_string(++index) + ") ";
-        result += '"' + field + '"' + '\n';
-
-        result += std::to_string(++index) + ") ";
-        result += '"' + value + '"' + '\n';
-    }
-    if (!result.empty()) {
-        result.pop_back();
+        const Entry *const entry{this->find(key)};
+        if (entry == nullptr) return toInteger(-2);
+        if (entry->getExpiration() == 0) return toInteger(-1);
 
-        return result;
+        remaining = entry->getExpiration() - getTime();
     }
 
-    return emptyArray;
+    return toInteger(isMillisecond ? remaining : (remaining + 500) / 1000);
 }
 
-auto Database::hincrBy(std::string_view statement) -> std::string {
-    std::string value;
+auto Database::crement(const std::string_view key, const long digital, const bool isPlus) -> Reply {
+    long number;
 
     {
-        unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
-
-        space = statement.find(' ');
-        std::string field{statement.substr(0, space)};
-        const auto crement{std::stol(std::string{statement.substr(space + 1)})};
+        const std::lock_guard lockGuard{this->getShard(key).lock};
 
-        const std::lock_guard lockGuard{this->lock};
-
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash) {
-                std::unordered_map<std::string, std::string> &hash{entry->getHash()};
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::string) return wrongType;
 
-                if (const auto result{hash.find(field)}; result != hash.cend()) {
-                    if (isInteger(result->second)) {
-                        result->second = std::to_string(std::stol(result->second) + crement);
+            const std::optional oldNumber{entry->getInteger()};
+            if (!oldNumber.has_value()) return wrongInteger;
+            if (isPlus ? __builtin_add_overflow(*oldNumber, digital, &number)
+                       : __builtin_sub_overflow(*oldNumber, digital, &number))
+                return overflow;
 
-                        value = result->second;
-                    } else return wrongInteger;
-                } else {
-                    value = std::to_string(crement);
-                    hash.emplace(std::move(field), value);
-                }
-            } else return wrongType;
+            this->replace(key, *entry, Entry{number});
         } else {
-            value = std::to_string(crement);
+            if (isPlus ? __builtin_add_overflow(0L, digital, &number) : __builtin_sub_overflow(0L, digital, &number))
+                return overflow;
 
-            this->skiplist.insert(std::make_shared<Entry>(
-                std::string{
-                    key
-            },
-                std::unordered_map{std::pair{std::move(field), std::string{value}}}));
+            this->insert(key, Entry{number});
         }
     }
 
-    return integer + value;
+    return toInteger(number);
 }
 
-auto Database::hkeys(const std::string_view statement) -> std::string {
-    std::vector<std::string> fileds;
+auto Database::combine(const std::span<const std::string_view> keys,
+                       auto (*const operation)(std::span<const Set *const> sets)->Set) -> Reply {
+    std::vector<std::string> members;
 
     {
-        const std::shared_lock sharedLock{this->lock};
+        const std::vector sharedLocks{this->lockShared(keys)};
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash)
-                for (const std::string_view filed : entry->getHash() | std::views::keys) fileds.emplace_back(filed);
-            else return wrongType;
-        }
-    }
+        const Set empty;
+        std::vector<const Set *> sets;
+        for (const auto key : keys) {
+            if (Entry *const entry{this->find(key)}; entry != nullptr) {
+                if (entry->getType() != Entry::Type::set) return wrongType;
 
-    std::string result;
-    unsigned long index{};
-    for (const auto &filed : fileds) {
-        result += std::to_string(++index) + ") ";
-        result += '"' + filed + '"' + '\n';
-    }
-    if (!result.empty()) {
-        result.pop_back();
+                sets.emplace_back(&entry->getSet());
+            } else sets.emplace_back(&empty);
+        }
 
-        return result;
+        operation(sets).traverse([&members](const std::string_view member) { members.emplace_back(member); });
     }
 
-    return emptyArray;
+    return toArray(members);
 }
 
-auto Database::hlen(const std::string_view statement) -> std::string {
-    unsigned long size{};
+auto Database::addToBloomFilter(const std::span<const std::string_view> arguments, const bool isMultiple)
+    -> Reply {
+    std::vector<Reply> replies;
 
     {
-        const std::shared_lock sharedLock{this->lock};
+        if (isMultiple ? arguments.size() < 2 : arguments.size() != 2) return syntaxError;
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash) size = entry->getHash().size();
-            else return wrongType;
+        const auto key{arguments.front()};
+
+        const std::lock_guard lockGuard{this->getShard(key).lock};
+
+        Entry *entry{this->find(key)};
+        if (entry == nullptr) {
+            this->insert(key, Entry{BloomFilter{BloomFilter::defaultErrorRate, BloomFilter::defaultCapacity,
+                                                BloomFilter::defaultExpansion}});
+            entry = this->find(key);
+        } else if (entry->getType() != Entry::Type::bloomFilter) return wrongType;
+
+        for (const std::optional result : entry->getBloomFilter().add(arguments.subspan(1))) {
+            if (result.has_value()) replies.emplace_back(toInteger(*result));
+            else replies.emplace_back(toError("ERR non scaling filter is full"));
         }
     }
 
-    return integer + std::to_string(size);
+    return isMultiple ? Reply{std::move(replies)} : std::move(replies.front());
 }
 
-auto Database::hset(std::string_view statement) -> std::string {
-    unsigned long count{};
+auto Database::findInBloomFilter(const std::span<const std::string_view> arguments, const bool isMultiple)
+    -> Reply {
+    std::vector<Reply> replies;
 
     {
-        unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
+        if (isMultiple ? arguments.size() < 2 : arguments.size() != 2) return syntaxError;
 
-        std::vector<std::pair<std::string_view, std::string_view>> filedValues;
-        while (!statement.empty()) {
-            space = statement.find(' ');
-            const auto field{statement.substr(0, space)};
-            statement.remove_prefix(space + 1);
-
-            space = statement.find(' ');
-            std::string_view value;
-            if (space != std::string_view::npos) {
-                value = statement.substr(0, space);
-                statement.remove_prefix(space + 1);
-            } else {
-                value = statement;
-                statement = {};
-            }
+        const auto key{arguments.front()};
+        const auto elements{arguments.subspan(1)};
 
-            filedValues.emplace_back(field, value);
-        }
+        const std::shared_lock sharedLock{this->getShard(key).lock};
 
-        bool isNew{};
-        std::unordered_map<std::string, std::string> newHash;
+        if (Entry *const entry{this->find(key)}; entry != nullptr) {
+            if (entry->getType() != Entry::Type::bloomFilter) return wrongType;
 
-        const std::lock_guard lockGuard{this->lock};
+            for (const bool result : entry->getBloomFilter().contains(elements))
+                replies.emplace_back(toInteger(result));
+        } else replies.assign(elements.size(), toInteger(0));
+    }
 
-        const std::shared_ptr entry{this->skiplist.find(key)};
-        if (entry != nullptr) {
-            if (entry->getType() != Entry::Type::hash) return wrongType;
-        } else isNew = true;
+    return isMultiple ? Reply{std::move(replies)} : std::move(replies.front());
+}
 
-        for (const auto &[first, second] : filedValues) {
-            std::string filed{first}, value{second};
+auto Database::reserveCountMinSketch(const std::string_view key, const unsigned long width, const unsigned long depth)
+    -> Reply {
+    if (!CountMinSketch::isCreatable(width, depth)) return toError("CMS: invalid width/depth");
 
-            if (!isNew) {
-                std::unordered_map<std::string, std::string> &hash{entry->getHash()};
+    const std::lock_guard lockGuard{this->getShard(key).lock};
 
-                if (!hash.contains(filed)) ++count;
-                hash[std::move(filed)] = std::move(value);
-            } else newHash.emplace(std::move(filed), std::move(value));
-        }
+    if (this->find(key) != nullptr) return toError("CMS: key already exists");
 
-        if (isNew) {
-            count = newHash.size();
-            this->skiplist.insert(std::make_shared<Entry>(std::string{key}, std::move(newHash)));
-        }
-    }
+    this->insert(key, Entry{CountMinSketch{static_cast<unsigned int>(width), static_cast<unsigned int>(depth)}});
 
-    return integer + std::to_string(count);
+    return ok;
 }
 
-auto Database::hvals(const std::string_view statement) -> std::string {
-    std::vector<std::string> values;
+auto Database::find(const std::string_view key) -> Entry * {
+    Shard &shard{this->getShard(key)};
 
-    {
-        const std::shared_lock sharedLock{this->lock};
+    Node *const node{shard.hashIndex.find(key)};
+    if (node == nullptr) return nullptr;
+    this->preserve(shard, node);
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::hash)
-                for (const std::string_view value : entry->getHash() | std::views::values) values.emplace_back(value);
-            else return wrongType;
-        }
-    }
+    Entry &entry{node->getEntry()};
+    if (const long expiration{entry.getExpiration()}; expiration != 0 && expiration <= getTime()) return nullptr;
+    if (Config::getMaxmemory() != 0) entry.touch();
 
-    std::string result;
-    unsigned long index{};
-    for (const auto &value : values) {
-        result += std::to_string(++index) + ") ";
-        result += '"' + value + '"' + '\n';
-    }
-    if (!result.empty()) {
-        result.pop_back();
+    return &entry;
+}
 
-        return result;
-    }
+auto Database::peek(const std::string_view key) noexcept -> const Entry * {
+    Node *const node{this->getShard(key).hashIndex.find(key)};
+    if (node == nullptr) return nullptr;
+
+    Entry &entry{node->getEntry()};
+    if (const long expiration{entry.getExpiration()}; expiration != 0 && expiration <= getTime()) return nullptr;
+    if (Config::getMaxmemory() != 0) entry.touch();
 
-    return emptyArray;
+    return &entry;
 }
 
-auto Database::lindex(const std::string_view statement) -> std::string {
-    std::string element;
+auto Database::peek(const std::string_view key, const std::function<auto(const Entry *entry)->Reply> &reader)
+    -> Reply {
+    const Epoch::Guard guard;
 
-    {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        auto index{std::stol(std::string{statement.substr(space + 1)})};
+    if (const Entry *const entry{this->peek(key)}; entry == nullptr || !entry->isEditedInPlace()) return reader(entry);
 
-        const std::shared_lock sharedLock{this->lock};
+    const std::shared_lock sharedLock{this->getShard(key).lock};
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::list) {
-                const std::deque<std::string> &list{entry->getList()};
-                const auto listSize{static_cast<decltype(index)>(list.size())};
+    return reader(this->find(key));
+}
 
-                index = index < 0 ? listSize + index : index;
-                if (index >= listSize || index < 0) return nil;
+auto Database::insert(const std::string_view key, Entry &&entry) -> void {
+    Shard &shard{this->getShard(key)};
 
-                element = list[index];
-            } else return wrongType;
-        } else return nil;
+    if (entry.getExpiration() != 0) shard.volatileKeys.emplace(key);
+    else if (!shard.volatileKeys.empty()) {
+        if (const auto result{shard.volatileKeys.find(key)}; result != shard.volatileKeys.cend())
+            shard.volatileKeys.erase(result);
+    }
+
+    entry.setMemory(0);
+    if (Config::getMaxmemory() != 0) entry.touch();
+
+    if (Node *const node{shard.hashIndex.find(key)}; node != nullptr) {
+        this->preserve(shard, node);
+        this->memory.fetch_sub(node->getEntry().getMemory(), std::memory_order::relaxed);
+
+        node->setEntry(std::move(entry));
+        node->setVersion(this->snapshotVersion.load(std::memory_order::relaxed));
+        this->account(key, node->getEntry());
+
+        return;
     }
 
-    return '"' + element + '"';
+    Node *const node{Node::create(*this->arena, key, std::move(entry), Skiplist::randomLevel())};
+    node->setVersion(this->snapshotVersion.load(std::memory_order::relaxed));
+    this->account(key, node->getEntry());
+
+    shard.skiplist.insert(node);
+    shard.hashIndex.insert(node);
 }
 
-auto Database::llen(const std::string_view statement) -> std::string {
-    unsigned long size{};
+auto Database::replace(const std::string_view key, const Entry &entry, Entry &&value) -> void {
+    value.setExpiration(entry.getExpiration());
+    this->insert(key, std::move(value));
+}
 
-    {
-        const std::shared_lock sharedLock{this->lock};
+auto Database::update(const std::string_view key, Entry &entry,
+                      const std::function<auto(std::string &bytes)->void> &modify) -> void {
+    if (entry.isEditedInPlace()) {
+        modify(entry.getString());
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::list) size = entry->getList().size();
-            else return wrongType;
-        }
+        return;
     }
 
-    return integer + std::to_string(size);
+    std::string bytes{entry.toString()};
+    modify(bytes);
+
+    this->replace(key, entry, Entry{std::move(bytes)});
 }
 
-auto Database::lpop(const std::string_view statement) -> std::string {
-    std::string element;
+auto Database::erase(const std::string_view key) -> bool {
+    Shard &shard{this->getShard(key)};
 
-    {
-        const std::lock_guard lockGuard{this->lock};
+    Node *const node{shard.hashIndex.erase(key)};
+    if (node == nullptr) return false;
+    this->preserve(shard, node);
 
-        if (const std::shared_ptr entry{this->skiplist.find(statement)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::list) {
-                if (std::deque<std::string> & list{entry->getList()}; !list.empty()) {
-                    element = std::move(list.front());
-                    list.pop_front();
-                }
-            } else return wrongType;
-        }
+    if (node->getEntry().getExpiration() != 0) {
+        if (const auto result{shard.volatileKeys.find(key)}; result != shard.volatileKeys.cend())
+            shard.volatileKeys.erase(result);
     }
+    this->memory.fetch_sub(node->getEntry().getMemory(), std::memory_order::relaxed);
 
-    if (!element.empty()) return '"' + element + '"';
+    static_cast<void>(shard.skiplist.erase(key));
+    Node::retire(*this->arena, node);
 
-    return nil;
+    return true;
 }
 
-auto Database::lpush(std::string_view statement) -> std::string {
-    unsigned long size;
+auto Database::preserve(Shard &shard, Node *const node) -> void {
+    if (!this->isSnapshotting.load(std::memory_order::acquire) ||
+        !node->claim(this->snapshotVersion.load(std::memory_order::relaxed)))
+        return;
 
-    {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
+    const std::vector serializedEntry{node->getEntry().serialize(node->getKey())};
+
+    const std::lock_guard lockGuard{shard.snapshotLock};
+    shard.snapshot.insert(shard.snapshot.cend(), serializedEntry.cbegin(), serializedEntry.cend());
+}
 
-        std::vector<std::string> elements;
-        for (const auto &view : statement | std::views::split(' ')) elements.emplace_back(std::string_view{view});
+auto Database::detach(Entry &entry) -> Entry {
+    if (entry.getType() != Entry::Type::string) return std::move(entry);
 
-        bool isNew{};
-        std::deque<std::string> newList;
+    Entry value{entry.toString()};
+    value.setExpiration(entry.getExpiration());
 
-        const std::lock_guard lockGuard{this->lock};
+    return value;
+}
 
-        const std::shared_ptr entry{this->skiplist.find(key)};
-        if (entry != nullptr) {
-            if (entry->getType() != Entry::Type::list) return wrongType;
-        } else isNew = true;
+auto Database::getShardIndex(const std::string_view key) noexcept -> unsigned long {
+    return Node::hash(key) >> std::countl_zero(shardCount - 1);
+}
 
-        for (auto &element : elements) {
-            if (!isNew) entry->getList().emplace_front(std::move(element));
-            else newList.emplace_front(std::move(element));
-        }
+auto Database::getTime() noexcept -> long {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
 
-        if (!isNew) size = entry->getList().size();
-        else {
-            size = newList.size();
-            this->skiplist.insert(std::make_shared<Entry>(std::string{key}, std::move(newList)));
-        }
-    }
+auto Database::getDeadline(const std::string_view unit, const long time) noexcept -> std::optional<long> {
+    long deadline;
+    if (isOption(unit, "EX")) {
+        if (__builtin_mul_overflow(time, 1000, &deadline) || __builtin_add_overflow(deadline, getTime(), &deadline))
+            return std::nullopt;
+    } else if (isOption(unit, "PX")) {
+        if (__builtin_add_overflow(time, getTime(), &deadline)) return std::nullopt;
+    } else if (isOption(unit, "EXAT")) {
+        if (__builtin_mul_overflow(time, 1000, &deadline)) return std::nullopt;
+    } else if (isOption(unit, "PXAT")) deadline = time;
+    else return std::nullopt;
+
+    return std::max(deadline, 1L);
+}
+
+auto Database::parseExpiration(const std::span<const std::string_view> options) noexcept -> std::optional<long> {
+    if (options.empty()) return 0;
+    if (options.size() != 2) return std::nullopt;
+
+    const std::optional time{Entry::parseInteger(options[1])};
+    if (!time.has_value() || *time <= 0) return std::nullopt;
 
-    return integer + std::to_string(size);
+    return getDeadline(options.front(), *time);
 }
 
-auto Database::lpushx(std::string_view statement) -> std::string {
-    unsigned long size{};
+auto Database::measure(const std::string_view key, const Entry &entry) noexcept -> unsigned long {
+    return sizeof(Node) + key.size() + sizeof(void *) * 2 + entry.measure();
+}
 
-    {
-        const unsigned long space{statement.find(' ')};
-        const auto key{statement.substr(0, space)};
-        statement.remove_prefix(space + 1);
+auto Database::account(const std::string_view key, Entry &entry) noexcept -> void {
+    if (Config::getMaxmemory() == 0) return;
 
-        std::vector<std::string> elements;
-        for (const auto &view : statement | std::views::split(' ')) elements.emplace_back(std::string_view{view});
+    const unsigned long memory{measure(key, entry)};
+    this->memory.fetch_add(memory - entry.getMemory(), std::memory_order::relaxed);
+    entry.setMemory(memory);
+}
 
-        const std::lock_guard lockGuard{this->lock};
+auto Database::getShard(const std::string_view key) noexcept -> Shard & { return this->shards[getShardIndex(key)]; }
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::list) {
-                std::deque<std::string> &list{entry->getList()};
+auto Database::getShard(const std::string_view key) const noexcept -> const Shard & {
+    return this->shards[getShardIndex(key)];
+}
 
-                for (auto &element : elements) list.emplace_front(std::move(element));
-                size = list.size();
-            } else return wrongType;
-        }
-    }
+auto Database::lock(const std::span<const std::string_view> keys) -> std::vector<std::unique_lock<ShardLock>> {
+    std::vector<std::unique_lock<ShardLock>> lockGuards;
+    for (const unsigned long shardIndex : getShardIndexes(keys)) lockGuards.emplace_back(this->shards[shardIndex].lock);
 
-    return integer + std::to_string(size);
+    return lockGuards;
 }
 
-auto Database::crement(const std::string_view key, const long digital, const bool isPlus) -> std::string {
-    long number;
+auto Database::lockShared(const std::span<const std::string_view> keys) -> std::vector<std::shared_lock<ShardLock>> {
+    std::vector<std::shared_lock<ShardLock>> sharedLocks;
+    for (const unsigned long shardIndex : getShardIndexes(keys))
+        sharedLocks.emplace_back(this->shards[shardIndex].lock);
 
-    {
-        const std::lock_guard lockGuard{this->lock};
+    return sharedLocks;
+}
 
-        if (const std::shared_ptr entry{this->skiplist.find(key)}; entry != nullptr) {
-            if (entry->getType() == Entry::Type::string) {
-                if (std::string & value{entry->getString()}; isInteger(value)) {
-                    number = isPlus ? std::stol(value) + digital : std::stol(value) - digital;
+auto Database::lockAll() -> std::vector<std::unique_lock<ShardLock>> {
+    std::vector<std::unique_lock<ShardLock>> lockGuards;
+    for (Shard &shard : this->shards) lockGuards.emplace_back(shard.lock);
 
-                    value = std::to_string(number);
-                } else return wrongInteger;
-            } else return wrongType;
-        } else {
-            number = digital;
+    return lockGuards;
+}
 
-            this->skiplist.insert(std::make_shared<Entry>(std::string{key}, std::string{std::to_string(number)}));
-        }
-    }
+auto Database::getShardIndexes(const std::span<const std::string_view> keys) -> std::vector<unsigned long> {
+    std::vector<unsigned long> shardIndexes;
+    for (const auto key : keys) shardIndexes.emplace_back(getShardIndex(key));
+
+    std::ranges::sort(shardIndexes);
+    const auto [first, last]{std::ranges::unique(shardIndexes)};
+    shardIndexes.erase(first, last);
 
-    return integer + std::to_string(number);
+    return shardIndexes;
 }
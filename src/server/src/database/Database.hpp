@@ -1,11 +1,44 @@
 #pragma once
 
+#include "../protocol/Reply.hpp"
+#include "Arena.hpp"
+#include "HashIndex.hpp"
+#include "ShardLock.hpp"
 #include "Skiplist.hpp"
+#include "StringHash.hpp"
 
-#include <shared_mutex>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <unordered_set>
 
 class Database {
+    struct Shard {
+        Skiplist skiplist;
+        HashIndex hashIndex;
+        std::unordered_set<std::string, StringHash, std::equal_to<>> volatileKeys;
+        ShardLock lock;
+        std::vector<std::byte> snapshot;
+        std::mutex snapshotLock;
+    };
+
 public:
+    struct EvictionCandidate {
+        unsigned long idle, database;
+        std::string key;
+    };
+
+    [[nodiscard]] static auto getShardIndex(std::string_view key) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getTime() noexcept -> long;
+
+    [[nodiscard]] static auto getDeadline(std::string_view unit, long time) noexcept -> std::optional<long>;
+
+    [[nodiscard]] static auto parseExpiration(std::span<const std::string_view> options) noexcept
+        -> std::optional<long>;
+
     Database(unsigned long index, std::span<const std::byte> data);
 
     Database(const Database &) = delete;
@@ -18,85 +51,264 @@ public:
 
     ~Database() = default;
 
+    auto snapshot() noexcept -> void;
+
     [[nodiscard]] auto serialize() -> std::vector<std::byte>;
 
-    [[nodiscard]] auto del(std::string_view statement) -> std::string;
+    auto activeExpire(std::chrono::steady_clock::time_point deadline) -> void;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    auto refresh(std::string_view key) -> void;
+
+    auto sample(std::vector<EvictionCandidate> &candidates) -> void;
+
+    [[nodiscard]] auto evict(std::string_view key) -> bool;
+
+    [[nodiscard]] auto del(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto exists(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto move(std::unordered_map<unsigned long, Database> &databases,
+                            std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto rename(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto renamenx(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto type(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto scan(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto range(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto expire(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto expireAt(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto pexpire(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto pexpireAt(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto persist(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto pttl(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto ttl(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto set(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto get(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto getRange(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto getBit(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto mget(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto setBit(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bitCount(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bitPos(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bitOp(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bitField(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto setnx(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto setRange(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto strlen(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto mset(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto msetnx(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto incr(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto incrBy(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto decr(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto decrBy(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto append(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto exists(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hdel(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto move(std::unordered_map<unsigned long, Database> &databases, std::string_view statement)
-        -> std::string;
+    [[nodiscard]] auto hexists(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto rename(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hget(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto renamenx(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hgetAll(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto type(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hincrBy(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto set(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hkeys(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto get(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hlen(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto getRange(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hscan(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto getBit(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hset(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto mget(std::string_view statement) -> std::string;
+    [[nodiscard]] auto hvals(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto setBit(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lindex(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto setnx(std::string_view statement) -> std::string;
+    [[nodiscard]] auto llen(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto setRange(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lpop(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto strlen(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lpush(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto mset(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lpushx(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto msetnx(std::string_view statement) -> std::string;
+    [[nodiscard]] auto linsert(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto incr(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lrange(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto incrBy(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lrem(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto decr(std::string_view statement) -> std::string;
+    [[nodiscard]] auto lset(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto decrBy(std::string_view statement) -> std::string;
+    [[nodiscard]] auto ltrim(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto append(std::string_view statement) -> std::string;
+    [[nodiscard]] auto rpop(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hdel(std::string_view statement) -> std::string;
+    [[nodiscard]] auto rpush(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hexists(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sadd(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hget(std::string_view statement) -> std::string;
+    [[nodiscard]] auto scard(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hgetAll(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sdiff(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hincrBy(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sinter(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hkeys(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sinterCard(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hlen(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sismember(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hset(std::string_view statement) -> std::string;
+    [[nodiscard]] auto smembers(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto hvals(std::string_view statement) -> std::string;
+    [[nodiscard]] auto srem(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lindex(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sscan(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto llen(std::string_view statement) -> std::string;
+    [[nodiscard]] auto sunion(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lpop(std::string_view statement) -> std::string;
+    [[nodiscard]] auto zadd(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lpush(std::string_view statement) -> std::string;
+    [[nodiscard]] auto zcount(std::span<const std::string_view> arguments) -> Reply;
 
-    [[nodiscard]] auto lpushx(std::string_view statement) -> std::string;
+    [[nodiscard]] auto zincrBy(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto zrange(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto zrangeByScore(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto zrank(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto zrem(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto zscore(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto pfAdd(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto pfCount(std::span<const std::string_view> keys) -> Reply;
+
+    [[nodiscard]] auto pfMerge(std::span<const std::string_view> keys) -> Reply;
+
+    [[nodiscard]] auto bfReserve(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bfAdd(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bfMadd(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bfExists(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto bfMexists(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto cmsInitByDim(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto cmsInitByProb(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto cmsIncrBy(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto cmsQuery(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto topkReserve(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto topkAdd(std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto topkList(std::span<const std::string_view> arguments) -> Reply;
 
 private:
-    [[nodiscard]] auto crement(std::string_view key, long digital, bool isPlus) -> std::string;
+    [[nodiscard]] auto find(std::string_view key) -> Entry *;
+
+    [[nodiscard]] auto peek(std::string_view key) noexcept -> const Entry *;
+
+    [[nodiscard]] auto peek(std::string_view key, const std::function<auto(const Entry *entry)->Reply> &reader)
+        -> Reply;
+
+    auto insert(std::string_view key, Entry &&entry) -> void;
+
+    auto replace(std::string_view key, const Entry &entry, Entry &&value) -> void;
+
+    auto update(std::string_view key, Entry &entry, const std::function<auto(std::string &bytes)->void> &modify)
+        -> void;
+
+    auto erase(std::string_view key) -> bool;
+
+    auto preserve(Shard &shard, Node *node) -> void;
+
+    [[nodiscard]] static auto detach(Entry &entry) -> Entry;
+
+    [[nodiscard]] static auto measure(std::string_view key, const Entry &entry) noexcept -> unsigned long;
+
+    auto account(std::string_view key, Entry &entry) noexcept -> void;
+
+    [[nodiscard]] auto getShard(std::string_view key) noexcept -> Shard &;
+
+    [[nodiscard]] auto getShard(std::string_view key) const noexcept -> const Shard &;
+
+    [[nodiscard]] auto lock(std::span<const std::string_view> keys) -> std::vector<std::unique_lock<ShardLock>>;
+
+    [[nodiscard]] auto lockShared(std::span<const std::string_view> keys) -> std::vector<std::shared_lock<ShardLock>>;
+
+    [[nodiscard]] auto lockAll() -> std::vector<std::unique_lock<ShardLock>>;
+
+    [[nodiscard]] static auto getShardIndexes(std::span<const std::string_view> keys) -> std::vector<unsigned long>;
+
+    [[nodiscard]] auto collect(std::string_view start, bool isExclusive,
+                               const std::function<auto(std::string_view key)->bool> &isInRange, unsigned long count)
+        -> std::pair<std::vector<std::string>, std::optional<std::string>>;
+
+    [[nodiscard]] auto setDeadline(std::span<const std::string_view> arguments, std::string_view unit) -> Reply;
+
+    [[nodiscard]] auto getRemaining(std::string_view key, bool isMillisecond) -> Reply;
+
+    [[nodiscard]] auto crement(std::string_view key, long digital, bool isPlus) -> Reply;
+
+    [[nodiscard]] auto combine(std::span<const std::string_view> keys,
+                               auto (*operation)(std::span<const Set *const> sets)->Set) -> Reply;
+
+    [[nodiscard]] auto addToBloomFilter(std::span<const std::string_view> arguments, bool isMultiple) -> Reply;
+
+    [[nodiscard]] auto findInBloomFilter(std::span<const std::string_view> arguments, bool isMultiple) -> Reply;
+
+    [[nodiscard]] auto reserveCountMinSketch(std::string_view key, unsigned long width, unsigned long depth)
+        -> Reply;
+
+    static constexpr unsigned long shardCount{64}, expireSampleCount{20}, snapshotBatchSize{1024};
+    static_assert(shardCount > 1 && std::has_single_bit(shardCount));
 
-    unsigned long index;
-    Skiplist skiplist;
-    std::shared_mutex lock;
+    unsigned long index, expireCursor{};
+    std::atomic<unsigned long> memory{}, snapshotVersion{};
+    std::atomic_bool isSnapshotting{};
+    std::unique_ptr<Arena> arena{std::make_unique<Arena>()};
+    std::array<Shard, shardCount> shards;
 };
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "StringHash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename Element> class Dictionary {
+public:
+    [[nodiscard]] auto size() const noexcept -> unsigned long { return this->count; }
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long {
+        return this->count * sizeof(Element) + this->buckets.size() * sizeof(Bucket);
+    }
+
+    [[nodiscard]] auto find(const std::string_view key) noexcept -> Element * {
+        return const_cast<Element *>(std::as_const(*this).find(key));
+    }
+
+    [[nodiscard]] auto find(const std::string_view key) const noexcept -> const Element * {
+        if (this->buckets.empty()) return nullptr;
+
+        const Bucket &bucket{this->buckets[StringHash{}(key) & (this->buckets.size() - 1)]};
+        const auto result{std::ranges::find(bucket, key, getKey)};
+
+        return result != bucket.cend() ? &*result : nullptr;
+    }
+
+    template <typename... Arguments> auto emplace(const std::string_view key, Arguments &&...arguments) -> bool {
+        if (this->find(key) != nullptr) return false;
+
+        if (this->count >= this->buckets.size()) this->resize(std::max(initialCapacity, this->buckets.size() * 2));
+        this->buckets[StringHash{}(key) & (this->buckets.size() - 1)].emplace_back(
+            std::string{key}, std::forward<Arguments>(arguments)...);
+        ++this->count;
+
+        return true;
+    }
+
+    auto erase(const std::string_view key) noexcept -> std::optional<Element> {
+        if (this->buckets.empty()) return std::nullopt;
+
+        Bucket &bucket{this->buckets[StringHash{}(key) & (this->buckets.size() - 1)]};
+        const auto result{std::ranges::find(bucket, key, getKey)};
+        if (result == bucket.cend()) return std::nullopt;
+
+        std::iter_swap(result, bucket.end() - 1);
+        std::optional element{std::move(bucket.back())};
+        bucket.pop_back();
+        --this->count;
+
+        return element;
+    }
+
+    template <typename Action> auto traverse(const Action &action) const -> void {
+        for (const Bucket &bucket : this->buckets)
+            for (const Element &element : bucket) action(element);
+    }
+
+    template <typename Action>
+    [[nodiscard]] auto scan(unsigned long cursor, const unsigned long count, const Action &action) const
+        -> unsigned long {
+        if (this->buckets.empty()) return 0;
+
+        const unsigned long mask{this->buckets.size() - 1};
+        unsigned long scanned{};
+        do {
+            for (const Element &element : this->buckets[cursor & mask]) {
+                action(element);
+                ++scanned;
+            }
+
+            cursor = reverse(reverse(cursor | ~mask) + 1);
+        } while (cursor != 0 && scanned < count);
+
+        return cursor;
+    }
+
+private:
+    using Bucket = std::vector<Element>;
+
+    [[nodiscard]] static auto getKey(const Element &element) noexcept -> std::string_view {
+        if constexpr (std::is_same_v<Element, std::string>) return element;
+        else return element.first;
+    }
+
+    [[nodiscard]] static auto reverse(unsigned long value) noexcept -> unsigned long {
+        value = (value >> 1 & 0x5555555555555555) | (value & 0x5555555555555555) << 1;
+        value = (value >> 2 & 0x3333333333333333) | (value & 0x3333333333333333) << 2;
+        value = (value >> 4 & 0x0f0f0f0f0f0f0f0f) | (value & 0x0f0f0f0f0f0f0f0f) << 4;
+
+        return std::byteswap(value);
+    }
+
+    auto resize(const unsigned long capacity) -> void {
+        std::vector<Bucket> resizedBuckets(capacity);
+        for (Bucket &bucket : this->buckets) {
+            for (Element &element : bucket)
+                resizedBuckets[StringHash{}(getKey(element)) & (capacity - 1)].emplace_back(std::move(element));
+        }
+
+        this->buckets = std::move(resizedBuckets);
+    }
+
+    static constexpr unsigned long initialCapacity{8};
+
+    std::vector<Bucket> buckets;
+    unsigned long count{};
+};
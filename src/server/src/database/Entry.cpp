@@ -1,41 +1,45 @@
 #include "Entry.hpp"
 
+#include "../config/Config.hpp"
+
+#include <array>
+#include <charconv>
+#include <limits>
+#include <random>
 #include <utility>
 
-template<>
-struct std::hash<Entry::SortedSetElement> {
-    auto operator()(const Entry::SortedSetElement &other) const noexcept {
-        return hash<decltype(other.key)>{}(other.key);
-    }
-};
+Entry::Entry(std::string &&value) noexcept : type{Type::string} { this->setValue(std::move(value)); }
 
-auto Entry::SortedSetElement::operator<(const SortedSetElement &other) const noexcept -> bool {
-    return this->score < other.score;
-}
+Entry::Entry(const long value) noexcept : type{Type::string}, value{value} {}
+
+Entry::Entry(Hash &&value) noexcept : type{Type::hash}, value{std::move(value)} {}
 
-Entry::Entry(std::string &&key, std::string &&value) noexcept :
-    type{Type::string}, key{std::move(key)}, value{std::move(value)} {}
+Entry::Entry(List &&value) noexcept : type{Type::list}, value{std::move(value)} {}
 
-Entry::Entry(std::string &&key, std::unordered_map<std::string, std::string> &&value) noexcept :
-    type{Type::hash}, key{std::move(key)}, value{std::move(value)} {}
+Entry::Entry(Set &&value) noexcept : type{Type::set}, value{std::move(value)} {}
 
-Entry::Entry(std::string &&key, std::deque<std::string> &&value) noexcept :
-    type{Type::list}, key{std::move(key)}, value{std::move(value)} {}
+Entry::Entry(SortedSet &&value) noexcept : type{Type::sortedSet}, value{std::move(value)} {}
 
-Entry::Entry(std::string &&key, std::unordered_set<std::string> &&value) noexcept :
-    type{Type::set}, key{std::move(key)}, value{std::move(value)} {}
+Entry::Entry(HyperLogLog &&value) noexcept : type{Type::hyperLogLog}, value{std::move(value)} {}
 
-Entry::Entry(std::string &&key, std::set<SortedSetElement> &&value) noexcept :
-    type{Type::sortedSet}, key{std::move(key)}, value{std::move(value)} {}
+Entry::Entry(BloomFilter &&value) noexcept : type{Type::bloomFilter}, value{std::move(value)} {}
 
-Entry::Entry(std::span<const std::byte> serialization) : type{static_cast<Type>(serialization.front())} {
+Entry::Entry(CountMinSketch &&value) noexcept : type{Type::countMinSketch}, value{std::move(value)} {}
+
+Entry::Entry(TopK &&value) noexcept : type{Type::topK}, value{std::move(value)} {}
+
+Entry::Entry(std::span<const std::byte> serialization) :
+    type{static_cast<Type>(std::to_integer<unsigned char>(serialization.front()) & ~expirationFlag)} {
+    const bool isVolatile{(std::to_integer<unsigned char>(serialization.front()) & expirationFlag) != 0};
     serialization = serialization.subspan(sizeof(this->type));
 
-    const auto keySize{*reinterpret_cast<const unsigned long *>(serialization.data())};
-    serialization = serialization.subspan(sizeof(keySize));
+    if (isVolatile) {
+        this->expiration = *reinterpret_cast<const long *>(serialization.data());
+        serialization = serialization.subspan(sizeof(this->expiration));
+    }
 
-    this->key = {reinterpret_cast<const char *>(serialization.data()), keySize};
-    serialization = serialization.subspan(keySize);
+    const auto keySize{*reinterpret_cast<const unsigned long *>(serialization.data())};
+    serialization = serialization.subspan(sizeof(keySize) + keySize);
 
     switch (this->type) {
         case Type::string:
@@ -53,55 +57,215 @@ Entry::Entry(std::span<const std::byte> serialization) : type{static_cast<Type>(
         case Type::sortedSet:
             this->deserializeSortedSet(serialization);
             break;
+        case Type::hyperLogLog:
+            this->deserializeHyperLogLog(serialization);
+            break;
+        case Type::bloomFilter:
+            this->deserializeBloomFilter(serialization);
+            break;
+        case Type::countMinSketch:
+            this->deserializeCountMinSketch(serialization);
+            break;
+        case Type::topK:
+            this->deserializeTopK(serialization);
+            break;
     }
 }
 
+auto Entry::deserializeKey(std::span<const std::byte> serialization) -> std::string_view {
+    const bool isVolatile{(std::to_integer<unsigned char>(serialization.front()) & expirationFlag) != 0};
+    serialization = serialization.subspan(sizeof(Type) + (isVolatile ? sizeof(expiration) : 0));
+
+    const auto keySize{*reinterpret_cast<const unsigned long *>(serialization.data())};
+    serialization = serialization.subspan(sizeof(keySize));
+
+    return {reinterpret_cast<const char *>(serialization.data()), keySize};
+}
+
+auto Entry::parseInteger(const std::string_view text) noexcept -> std::optional<long> {
+    long integer;
+    if (const auto [end, error]{std::from_chars(text.data(), text.data() + text.size(), integer)};
+        error != std::errc{} || end != text.data() + text.size())
+        return std::nullopt;
+
+    std::array<char, std::numeric_limits<long>::digits10 + 2> buffer;
+    if (const auto [end, error]{std::to_chars(buffer.data(), buffer.data() + buffer.size(), integer)};
+        std::string_view{buffer.data(), end} != text)
+        return std::nullopt;
+
+    return integer;
+}
+
+auto Entry::tick() noexcept -> void { clock.fetch_add(1, std::memory_order::relaxed); }
+
 auto Entry::getType() const noexcept -> Type { return this->type; }
 
-auto Entry::getKey() const noexcept -> std::string_view { return this->key; }
+auto Entry::getExpiration() const noexcept -> long {
+    return std::atomic_ref{const_cast<long &>(this->expiration)}.load(std::memory_order::relaxed);
+}
 
-auto Entry::setKey(std::string &&key) noexcept -> void { this->key = std::move(key); }
+auto Entry::setExpiration(const long expiration) noexcept -> void {
+    std::atomic_ref{this->expiration}.store(expiration, std::memory_order::relaxed);
+}
 
-auto Entry::getString() -> std::string & { return std::get<std::string>(this->value); }
+auto Entry::touch() noexcept -> void {
+    const std::atomic_ref access{this->access};
+
+    if (!isLfu()) {
+        if (const unsigned int now{clock.load(std::memory_order::relaxed)};
+            access.load(std::memory_order::relaxed) != now)
+            access.store(now, std::memory_order::relaxed);
+
+        return;
+    }
 
-auto Entry::getHash() -> std::unordered_map<std::string, std::string> & {
-    return std::get<std::unordered_map<std::string, std::string>>(this->value);
+    unsigned int counter{access.load(std::memory_order::relaxed) == 0 ? lfuInitialCounter : this->getLfuCounter()};
+    if (counter < std::numeric_limits<unsigned char>::max()) {
+        thread_local std::minstd_rand generator{std::random_device{}()};
+
+        const unsigned int base{counter > lfuInitialCounter ? counter - lfuInitialCounter : 0};
+        if (std::uniform_real_distribution{}(generator) * (base * lfuLogFactor + 1) < 1) ++counter;
+    }
+
+    if (const unsigned int updated{getLfuTime() << 8 | counter}; access.load(std::memory_order::relaxed) != updated)
+        access.store(updated, std::memory_order::relaxed);
+}
+
+auto Entry::getIdle() const noexcept -> unsigned long {
+    if (isLfu()) return std::numeric_limits<unsigned char>::max() - this->getLfuCounter();
+
+    return clock.load(std::memory_order::relaxed) - this->getAccess();
 }
 
-auto Entry::getList() -> std::deque<std::string> & { return std::get<std::deque<std::string>>(this->value); }
+auto Entry::measure() const noexcept -> unsigned long {
+    switch (this->type) {
+        case Type::string:
+            if (const auto string{std::get_if<std::string>(&this->value)}; string != nullptr)
+                return string->capacity() > std::string{}.capacity() ? string->capacity() + 1 : 0;
+
+            return 0;
+        case Type::hash:
+            return std::get<Hash>(this->value).getMemory();
+        case Type::list:
+            return std::get<List>(this->value).getMemory();
+        case Type::set:
+            return std::get<Set>(this->value).getMemory();
+        case Type::sortedSet:
+            return std::get<SortedSet>(this->value).getMemory();
+        case Type::hyperLogLog:
+            return std::get<HyperLogLog>(this->value).getMemory();
+        case Type::bloomFilter:
+            return std::get<BloomFilter>(this->value).getMemory();
+        case Type::countMinSketch:
+            return std::get<CountMinSketch>(this->value).getMemory();
+        case Type::topK:
+            return std::get<TopK>(this->value).getMemory();
+    }
 
-auto Entry::getSet() -> std::unordered_set<std::string> & {
-    return std::get<std::unordered_set<std::string>>(this->value);
+    return 0;
 }
 
-auto Entry::getSortedSet() -> std::set<SortedSetElement> & { return std::get<std::set<SortedSetElement>>(this->value); }
+auto Entry::getMemory() const noexcept -> unsigned long { return this->memory; }
+
+auto Entry::setMemory(const unsigned long memory) noexcept -> void { this->memory = memory; }
+
+auto Entry::getInteger() const noexcept -> std::optional<long> {
+    if (const auto integer{std::get_if<long>(&this->value)}; integer != nullptr) return *integer;
+
+    return parseInteger(std::get<std::string>(this->value));
+}
+
+auto Entry::toString() const -> std::string {
+    if (const auto integer{std::get_if<long>(&this->value)}; integer != nullptr) return std::to_string(*integer);
+
+    return std::get<std::string>(this->value);
+}
+
+auto Entry::getBytes(std::string &buffer) const -> std::string_view {
+    if (const auto integer{std::get_if<long>(&this->value)}; integer != nullptr) {
+        buffer = std::to_string(*integer);
+
+        return buffer;
+    }
+
+    return std::get<std::string>(this->value);
+}
+
+auto Entry::isEditedInPlace() const noexcept -> bool { return this->isInPlace; }
+
+auto Entry::getString() -> std::string & { return std::get<std::string>(this->value); }
+
+auto Entry::getHash() -> Hash & { return std::get<Hash>(this->value); }
+
+auto Entry::getList() -> List & { return std::get<List>(this->value); }
+
+auto Entry::getSet() -> Set & { return std::get<Set>(this->value); }
+
+auto Entry::getSortedSet() -> SortedSet & { return std::get<SortedSet>(this->value); }
+
+auto Entry::getHyperLogLog() -> HyperLogLog & { return std::get<HyperLogLog>(this->value); }
+
+auto Entry::getBloomFilter() -> BloomFilter & { return std::get<BloomFilter>(this->value); }
+
+auto Entry::getCountMinSketch() -> CountMinSketch & { return std::get<CountMinSketch>(this->value); }
+
+auto Entry::getTopK() -> TopK & { return std::get<TopK>(this->value); }
 
 auto Entry::setValue(std::string &&value) noexcept -> void {
     this->type = Type::string;
-    this->value = std::move(value);
+
+    this->isInPlace = value.size() >= inPlaceSize;
+    if (const std::optional integer{parseInteger(value)}; integer.has_value()) this->value = *integer;
+    else this->value = std::move(value);
 }
 
-auto Entry::setValue(std::unordered_map<std::string, std::string> &&value) noexcept -> void {
+auto Entry::setValue(const long value) noexcept -> void {
+    this->type = Type::string;
+    this->isInPlace = false;
+    this->value = value;
+}
+
+auto Entry::setValue(Hash &&value) noexcept -> void {
     this->type = Type::hash;
     this->value = std::move(value);
 }
 
-auto Entry::setValue(std::deque<std::string> &&value) noexcept -> void {
+auto Entry::setValue(List &&value) noexcept -> void {
     this->type = Type::list;
     this->value = std::move(value);
 }
 
-auto Entry::setValue(std::unordered_set<std::string> &&value) noexcept -> void {
+auto Entry::setValue(Set &&value) noexcept -> void {
     this->type = Type::set;
     this->value = std::move(value);
 }
 
-auto Entry::setValue(std::set<SortedSetElement> &&value) noexcept -> void {
+auto Entry::setValue(SortedSet &&value) noexcept -> void {
     this->type = Type::sortedSet;
     this->value = std::move(value);
 }
 
-auto Entry::serialize() const -> std::vector<std::byte> {
+auto Entry::setValue(HyperLogLog &&value) noexcept -> void {
+    this->type = Type::hyperLogLog;
+    this->value = std::move(value);
+}
+
+auto Entry::setValue(BloomFilter &&value) noexcept -> void {
+    this->type = Type::bloomFilter;
+    this->value = std::move(value);
+}
+
+auto Entry::setValue(CountMinSketch &&value) noexcept -> void {
+    this->type = Type::countMinSketch;
+    this->value = std::move(value);
+}
+
+auto Entry::setValue(TopK &&value) noexcept -> void {
+    this->type = Type::topK;
+    this->value = std::move(value);
+}
+
+auto Entry::serialize(const std::string_view key) const -> std::vector<std::byte> {
     std::vector<std::byte> serializedValue;
     switch (this->type) {
         case Type::string:
@@ -119,33 +283,54 @@ auto Entry::serialize() const -> std::vector<std::byte> {
         case Type::sortedSet:
             serializedValue = this->serializeSortedSet();
             break;
+        case Type::hyperLogLog:
+            serializedValue = this->serializeHyperLogLog();
+            break;
+        case Type::bloomFilter:
+            serializedValue = this->serializeBloomFilter();
+            break;
+        case Type::countMinSketch:
+            serializedValue = this->serializeCountMinSketch();
+            break;
+        case Type::topK:
+            serializedValue = this->serializeTopK();
+            break;
     }
 
-    const std::vector serializedKey{this->serializeKey()};
-    const unsigned long size{sizeof(this->type) + serializedKey.size() + serializedValue.size()};
+    const std::vector serializedKey{serializeKey(key)};
+    const unsigned long size{sizeof(this->type) + (this->expiration != 0 ? sizeof(this->expiration) : 0) +
+                             serializedKey.size() + serializedValue.size()};
     std::vector<std::byte> serialization{sizeof(size)};
     *reinterpret_cast<std::remove_reference_t<std::remove_const_t<decltype(size)>> *>(serialization.data()) = size;
 
-    serialization.emplace_back(std::byte{std::to_underlying(this->type)});
+    if (this->expiration != 0) {
+        serialization.emplace_back(
+            std::byte{static_cast<unsigned char>(std::to_underlying(this->type) | expirationFlag)});
+
+        serialization.resize(serialization.size() + sizeof(this->expiration));
+        *reinterpret_cast<std::remove_const_t<decltype(this->expiration)> *>(
+            serialization.data() + serialization.size() - sizeof(this->expiration)) = this->expiration;
+    } else serialization.emplace_back(std::byte{std::to_underlying(this->type)});
     serialization.insert(serialization.cend(), serializedKey.cbegin(), serializedKey.cend());
     serialization.insert(serialization.cend(), serializedValue.cbegin(), serializedValue.cend());
 
     return serialization;
 }
 
-auto Entry::serializeKey() const -> std::vector<std::byte> {
-    const unsigned long size{this->key.size()};
+auto Entry::serializeKey(const std::string_view key) -> std::vector<std::byte> {
+    const unsigned long size{key.size()};
     std::vector<std::byte> serialization{sizeof(size)};
     *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serialization.data()) = size;
 
-    const auto bytes{std::as_bytes(std::span{this->key})};
+    const auto bytes{std::as_bytes(std::span{key})};
     serialization.insert(serialization.cend(), bytes.cbegin(), bytes.cend());
 
     return serialization;
 }
 
 auto Entry::serializeString() const -> std::vector<std::byte> {
-    const auto bytes{std::as_bytes(std::span{std::get<std::string>(this->value)})};
+    const std::string value{this->toString()};
+    const auto bytes{std::as_bytes(std::span{value})};
 
     return {bytes.cbegin(), bytes.cend()};
 }
@@ -153,7 +338,8 @@ auto Entry::serializeString() const -> std::vector<std::byte> {
 auto Entry::serializeHash() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    for (const auto &[elementKey, elementValue] : std::get<std::unordered_map<std::string, std::string>>(this->value)) {
+    std::get<Hash>(this->value).traverse([&serialization](const std::string_view elementKey,
+                                                         const std::string_view elementValue) {
         const unsigned long keySize{elementKey.size()};
         std::vector<std::byte> serializedElement{sizeof(keySize)};
         *reinterpret_cast<std::remove_const_t<decltype(keySize)> *>(serializedElement.data()) = keySize;
@@ -170,7 +356,7 @@ auto Entry::serializeHash() const -> std::vector<std::byte> {
         serializedElement.insert(serializedElement.cend(), valueBytes.cbegin(), valueBytes.cend());
 
         serialization.insert(serialization.cend(), serializedElement.cbegin(), serializedElement.cend());
-    }
+    });
 
     return serialization;
 }
@@ -178,16 +364,15 @@ auto Entry::serializeHash() const -> std::vector<std::byte> {
 auto Entry::serializeList() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    for (const std::string_view element : std::get<std::deque<std::string>>(this->value)) {
+    std::get<List>(this->value).traverse([&serialization](const std::string_view element) {
         const unsigned long size{element.size()};
-        std::vector<std::byte> serializedElement{sizeof(size)};
-        *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serializedElement.data()) = size;
+        serialization.resize(serialization.size() + sizeof(size));
+        *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serialization.data() + serialization.size() -
+                                                                 sizeof(size)) = size;
 
         const auto bytes{std::as_bytes(std::span{element})};
-        serializedElement.insert(serializedElement.cend(), bytes.cbegin(), bytes.cend());
-
-        serialization.insert(serialization.cend(), serializedElement.cbegin(), serializedElement.cend());
-    }
+        serialization.insert(serialization.cend(), bytes.cbegin(), bytes.cend());
+    });
 
     return serialization;
 }
@@ -195,7 +380,7 @@ auto Entry::serializeList() const -> std::vector<std::byte> {
 auto Entry::serializeSet() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    for (const std::string_view element : std::get<std::unordered_set<std::string>>(this->value)) {
+    std::get<Set>(this->value).traverse([&serialization](const std::string_view element) {
         const unsigned long size{element.size()};
         std::vector<std::byte> serializedElement{sizeof(size)};
         *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serializedElement.data()) = size;
@@ -204,7 +389,7 @@ auto Entry::serializeSet() const -> std::vector<std::byte> {
         serializedElement.insert(serializedElement.cend(), bytes.cbegin(), bytes.cend());
 
         serialization.insert(serialization.cend(), serializedElement.cbegin(), serializedElement.cend());
-    }
+    });
 
     return serialization;
 }
@@ -212,7 +397,7 @@ auto Entry::serializeSet() const -> std::vector<std::byte> {
 auto Entry::serializeSortedSet() const -> std::vector<std::byte> {
     std::vector<std::byte> serialization;
 
-    for (const auto &[key, score] : std::get<std::set<SortedSetElement>>(this->value)) {
+    std::get<SortedSet>(this->value).traverse([&serialization](const std::string_view key, const double score) {
         const unsigned long size{key.size() + sizeof(score)};
         std::vector<std::byte> serializedElement{sizeof(size)};
         *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serializedElement.data()) = size;
@@ -225,30 +410,43 @@ auto Entry::serializeSortedSet() const -> std::vector<std::byte> {
                                                                   sizeof(score)) = score;
 
         serialization.insert(serialization.cend(), serializedElement.cbegin(), serializedElement.cend());
-    }
+    });
 
     return serialization;
 }
 
+auto Entry::serializeHyperLogLog() const -> std::vector<std::byte> {
+    return std::get<HyperLogLog>(this->value).serialize();
+}
+
+auto Entry::serializeBloomFilter() const -> std::vector<std::byte> {
+    return std::get<BloomFilter>(this->value).serialize();
+}
+
+auto Entry::serializeCountMinSketch() const -> std::vector<std::byte> {
+    return std::get<CountMinSketch>(this->value).serialize();
+}
+
+auto Entry::serializeTopK() const -> std::vector<std::byte> { return std::get<TopK>(this->value).serialize(); }
+
 auto Entry::deserializeString(const std::span<const std::byte> serialization) -> void {
-    this->value = std::string{reinterpret_cast<const char *>(serialization.data()), serialization.size()};
+    this->setValue(std::string{reinterpret_cast<const char *>(serialization.data()), serialization.size()});
 }
 
 auto Entry::deserializeHash(std::span<const std::byte> serialization) -> void {
-    std::unordered_map<std::string, std::string> value;
+    Hash value;
 
     while (!serialization.empty()) {
         const auto elementKeySize{*reinterpret_cast<const unsigned long *>(serialization.data())};
         serialization = serialization.subspan(sizeof(elementKeySize));
 
-        std::string elementKey{reinterpret_cast<const char *>(serialization.data()), elementKeySize};
+        const std::string_view elementKey{reinterpret_cast<const char *>(serialization.data()), elementKeySize};
         serialization = serialization.subspan(elementKeySize);
 
         const auto elementValueSize{*reinterpret_cast<const unsigned long *>(serialization.data())};
         serialization = serialization.subspan(sizeof(elementValueSize));
 
-        value.emplace(std::move(elementKey),
-                      std::string{reinterpret_cast<const char *>(serialization.data()), elementValueSize});
+        value.set(elementKey, std::string_view{reinterpret_cast<const char *>(serialization.data()), elementValueSize});
         serialization = serialization.subspan(elementValueSize);
     }
 
@@ -256,13 +454,13 @@ auto Entry::deserializeHash(std::span<const std::byte> serialization) -> void {
 }
 
 auto Entry::deserializeList(std::span<const std::byte> serialization) -> void {
-    std::deque<std::string> value;
+    List value;
 
     while (!serialization.empty()) {
         const auto elementSize{*reinterpret_cast<const unsigned long *>(serialization.data())};
         serialization = serialization.subspan(sizeof(elementSize));
 
-        value.emplace_back(reinterpret_cast<const char *>(serialization.data()), elementSize);
+        value.pushBack(std::string_view{reinterpret_cast<const char *>(serialization.data()), elementSize});
         serialization = serialization.subspan(elementSize);
     }
 
@@ -270,13 +468,13 @@ auto Entry::deserializeList(std::span<const std::byte> serialization) -> void {
 }
 
 auto Entry::deserializeSet(std::span<const std::byte> serialization) -> void {
-    std::unordered_set<std::string> value;
+    Set value;
 
     while (!serialization.empty()) {
         const auto elementSize{*reinterpret_cast<const unsigned long *>(serialization.data())};
         serialization = serialization.subspan(sizeof(elementSize));
 
-        value.emplace(reinterpret_cast<const char *>(serialization.data()), elementSize);
+        value.insert(std::string_view{reinterpret_cast<const char *>(serialization.data()), elementSize});
         serialization = serialization.subspan(elementSize);
     }
 
@@ -284,21 +482,58 @@ auto Entry::deserializeSet(std::span<const std::byte> serialization) -> void {
 }
 
 auto Entry::deserializeSortedSet(std::span<const std::byte> serialization) -> void {
-    std::set<SortedSetElement> value;
+    SortedSet value;
 
     while (!serialization.empty()) {
         const auto elementSize{*reinterpret_cast<const unsigned long *>(serialization.data())};
         serialization = serialization.subspan(sizeof(elementSize));
 
         const unsigned long elementKeySize{elementSize - sizeof(double)};
-        std::string elementKey{reinterpret_cast<const char *>(serialization.data()), elementKeySize};
+        const std::string_view elementKey{reinterpret_cast<const char *>(serialization.data()), elementKeySize};
         serialization = serialization.subspan(elementKeySize);
 
         const auto elementScore{*reinterpret_cast<const double *>(serialization.data())};
         serialization = serialization.subspan(sizeof(elementScore));
 
-        value.emplace(std::move(elementKey), elementScore);
+        value.insert(elementKey, elementScore);
     }
 
     this->value = std::move(value);
 }
+
+auto Entry::deserializeHyperLogLog(const std::span<const std::byte> serialization) -> void {
+    this->value = HyperLogLog{serialization};
+}
+
+auto Entry::deserializeBloomFilter(const std::span<const std::byte> serialization) -> void {
+    this->value = BloomFilter{serialization};
+}
+
+auto Entry::deserializeCountMinSketch(const std::span<const std::byte> serialization) -> void {
+    this->value = CountMinSketch{serialization};
+}
+
+auto Entry::deserializeTopK(const std::span<const std::byte> serialization) -> void {
+    this->value = TopK{serialization};
+}
+
+auto Entry::isLfu() noexcept -> bool {
+    const Config::MaxmemoryPolicy policy{Config::getMaxmemoryPolicy()};
+
+    return policy == Config::MaxmemoryPolicy::allkeysLfu || policy == Config::MaxmemoryPolicy::volatileLfu;
+}
+
+auto Entry::getLfuTime() noexcept -> unsigned int { return clock.load(std::memory_order::relaxed) / 60 & 0xffff; }
+
+auto Entry::getAccess() const noexcept -> unsigned int {
+    return std::atomic_ref{const_cast<unsigned int &>(this->access)}.load(std::memory_order::relaxed);
+}
+
+auto Entry::getLfuCounter() const noexcept -> unsigned char {
+    const unsigned int access{this->getAccess()}, elapsed{(getLfuTime() - (access >> 8)) & 0xffff},
+        counter{access & 0xff};
+
+    return counter > elapsed ? counter - elapsed : 0;
+}
+
+constinit std::atomic<unsigned int> Entry::clock{};
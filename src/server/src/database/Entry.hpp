@@ -1,67 +1,121 @@
 #pragma once
 
-#include <deque>
-#include <set>
+#include "BloomFilter.hpp"
+#include "CountMinSketch.hpp"
+#include "Hash.hpp"
+#include "HyperLogLog.hpp"
+#include "List.hpp"
+#include "Set.hpp"
+#include "SortedSet.hpp"
+#include "TopK.hpp"
+
+#include <atomic>
+#include <optional>
 #include <span>
-#include <string>
-#include <unordered_map>
-#include <unordered_set>
-#include <variant>
 #include <vector>
 
 class Entry {
 public:
-    enum class Type : unsigned char { string, hash, list, set, sortedSet };
+    enum class Type : unsigned char { string, hash, list, set, sortedSet, hyperLogLog, bloomFilter, countMinSketch, topK };
 
-    struct SortedSetElement {
-        std::string key;
-        double score;
+    static constexpr unsigned long inPlaceSize{512};
 
-        [[nodiscard]] auto operator<(const SortedSetElement &) const noexcept -> bool;
-    };
+    explicit Entry(std::string &&value) noexcept;
 
-    explicit Entry(std::string &&key, std::string &&value = {}) noexcept;
+    explicit Entry(long value) noexcept;
 
-    explicit Entry(std::string &&key, std::unordered_map<std::string, std::string> &&value = {}) noexcept;
+    explicit Entry(Hash &&value) noexcept;
 
-    explicit Entry(std::string &&key, std::deque<std::string> &&value = {}) noexcept;
+    explicit Entry(List &&value) noexcept;
 
-    explicit Entry(std::string &&key, std::unordered_set<std::string> &&value = {}) noexcept;
+    explicit Entry(Set &&value) noexcept;
 
-    explicit Entry(std::string &&key, std::set<SortedSetElement> &&value = {}) noexcept;
+    explicit Entry(SortedSet &&value) noexcept;
+
+    explicit Entry(HyperLogLog &&value) noexcept;
+
+    explicit Entry(BloomFilter &&value) noexcept;
+
+    explicit Entry(CountMinSketch &&value) noexcept;
+
+    explicit Entry(TopK &&value) noexcept;
 
     explicit Entry(std::span<const std::byte> serialization);
 
+    [[nodiscard]] static auto deserializeKey(std::span<const std::byte> serialization) -> std::string_view;
+
+    [[nodiscard]] static auto parseInteger(std::string_view text) noexcept -> std::optional<long>;
+
+    static auto tick() noexcept -> void;
+
     [[nodiscard]] auto getType() const noexcept -> Type;
 
-    [[nodiscard]] auto getKey() const noexcept -> std::string_view;
+    [[nodiscard]] auto getExpiration() const noexcept -> long;
+
+    auto setExpiration(long expiration) noexcept -> void;
+
+    auto touch() noexcept -> void;
+
+    [[nodiscard]] auto getIdle() const noexcept -> unsigned long;
 
-    auto setKey(std::string &&key) noexcept -> void;
+    [[nodiscard]] auto measure() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    auto setMemory(unsigned long memory) noexcept -> void;
+
+    [[nodiscard]] auto getInteger() const noexcept -> std::optional<long>;
+
+    [[nodiscard]] auto toString() const -> std::string;
+
+    [[nodiscard]] auto getBytes(std::string &buffer) const -> std::string_view;
+
+    [[nodiscard]] auto isEditedInPlace() const noexcept -> bool;
 
     [[nodiscard]] auto getString() -> std::string &;
 
-    [[nodiscard]] auto getHash() -> std::unordered_map<std::string, std::string> &;
+    [[nodiscard]] auto getHash() -> Hash &;
+
+    [[nodiscard]] auto getList() -> List &;
+
+    [[nodiscard]] auto getSet() -> Set &;
+
+    [[nodiscard]] auto getSortedSet() -> SortedSet &;
+
+    [[nodiscard]] auto getHyperLogLog() -> HyperLogLog &;
 
-    [[nodiscard]] auto getList() -> std::deque<std::string> &;
+    [[nodiscard]] auto getBloomFilter() -> BloomFilter &;
 
-    [[nodiscard]] auto getSet() -> std::unordered_set<std::string> &;
+    [[nodiscard]] auto getCountMinSketch() -> CountMinSketch &;
 
-    [[nodiscard]] auto getSortedSet() -> std::set<SortedSetElement> &;
+    [[nodiscard]] auto getTopK() -> TopK &;
 
     auto setValue(std::string &&value) noexcept -> void;
 
-    auto setValue(std::unordered_map<std::string, std::string> &&value) noexcept -> void;
+    auto setValue(long value) noexcept -> void;
 
-    auto setValue(std::deque<std::string> &&value) noexcept -> void;
+    auto setValue(Hash &&value) noexcept -> void;
 
-    auto setValue(std::unordered_set<std::string> &&value) noexcept -> void;
+    auto setValue(List &&value) noexcept -> void;
 
-    auto setValue(std::set<SortedSetElement> &&value) noexcept -> void;
+    auto setValue(Set &&value) noexcept -> void;
 
-    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+    auto setValue(SortedSet &&value) noexcept -> void;
+
+    auto setValue(HyperLogLog &&value) noexcept -> void;
+
+    auto setValue(BloomFilter &&value) noexcept -> void;
+
+    auto setValue(CountMinSketch &&value) noexcept -> void;
+
+    auto setValue(TopK &&value) noexcept -> void;
+
+    [[nodiscard]] auto serialize(std::string_view key) const -> std::vector<std::byte>;
 
 private:
-    [[nodiscard]] auto serializeKey() const -> std::vector<std::byte>;
+    static constexpr unsigned char expirationFlag{0x80}, lfuInitialCounter{5}, lfuLogFactor{10};
+
+    [[nodiscard]] static auto serializeKey(std::string_view key) -> std::vector<std::byte>;
 
     [[nodiscard]] auto serializeString() const -> std::vector<std::byte>;
 
@@ -73,6 +127,14 @@ private:
 
     [[nodiscard]] auto serializeSortedSet() const -> std::vector<std::byte>;
 
+    [[nodiscard]] auto serializeHyperLogLog() const -> std::vector<std::byte>;
+
+    [[nodiscard]] auto serializeBloomFilter() const -> std::vector<std::byte>;
+
+    [[nodiscard]] auto serializeCountMinSketch() const -> std::vector<std::byte>;
+
+    [[nodiscard]] auto serializeTopK() const -> std::vector<std::byte>;
+
     auto deserializeString(std::span<const std::byte> serialization) -> void;
 
     auto deserializeHash(std::span<const std::byte> serialization) -> void;
@@ -83,9 +145,28 @@ private:
 
     auto deserializeSortedSet(std::span<const std::byte> serialization) -> void;
 
+    auto deserializeHyperLogLog(std::span<const std::byte> serialization) -> void;
+
+    auto deserializeBloomFilter(std::span<const std::byte> serialization) -> void;
+
+    auto deserializeCountMinSketch(std::span<const std::byte> serialization) -> void;
+
+    auto deserializeTopK(std::span<const std::byte> serialization) -> void;
+
+    [[nodiscard]] static auto isLfu() noexcept -> bool;
+
+    [[nodiscard]] static auto getLfuTime() noexcept -> unsigned int;
+
+    [[nodiscard]] auto getAccess() const noexcept -> unsigned int;
+
+    [[nodiscard]] auto getLfuCounter() const noexcept -> unsigned char;
+
+    static constinit std::atomic<unsigned int> clock;
+
     Type type;
-    std::string key;
-    std::variant<std::string, std::unordered_map<std::string, std::string>, std::deque<std::string>,
-                 std::unordered_set<std::string>, std::set<SortedSetElement>>
-        value;
+    bool isInPlace{};
+    unsigned int access{};
+    long expiration{};
+    unsigned long memory{};
+    std::variant<std::string, long, Hash, List, Set, SortedSet, HyperLogLog, BloomFilter, CountMinSketch, TopK> value;
 };
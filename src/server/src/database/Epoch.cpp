@@ -0,0 +1,103 @@
+#include "Epoch.hpp"
+
+#include <algorithm>
+
+Epoch::Participant::Participant() : epoch{0} {
+    Registry &registry{getRegistry()};
+
+    const std::lock_guard lockGuard{registry.lock};
+
+    registry.participants.emplace_back(this);
+}
+
+Epoch::Participant::~Participant() {
+    Registry &registry{getRegistry()};
+
+    const std::lock_guard lockGuard{registry.lock};
+
+    std::erase(registry.participants, this);
+    registry.orphans.insert(registry.orphans.cend(), this->retireds.cbegin(), this->retireds.cend());
+}
+
+Epoch::Registry::~Registry() {
+    for (const auto &[pointer, deleter, epoch] : this->orphans) deleter(pointer);
+}
+
+Epoch::Guard::Guard() {
+    if (Participant & participant{getParticipant()}; participant.nesting++ == 0) {
+        participant.epoch.store(globalEpoch.load(std::memory_order::relaxed), std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+    }
+}
+
+Epoch::Guard::~Guard() {
+    if (Participant & participant{getParticipant()}; --participant.nesting == 0)
+        participant.epoch.store(0, std::memory_order::release);
+}
+
+auto Epoch::getEpoch() noexcept -> unsigned long { return globalEpoch.load(); }
+
+auto Epoch::isReclaimable(const unsigned long epoch) noexcept -> bool {
+    return epoch + 2 <= globalEpoch.load(std::memory_order::acquire);
+}
+
+auto Epoch::retire(void *const pointer, void (*const deleter)(void *) noexcept) -> void {
+    Participant &participant{getParticipant()};
+    participant.retireds.emplace_back(pointer, deleter, getEpoch());
+
+    if (participant.retireds.size() % collectInterval == 0) {
+        tryAdvance();
+        collect(participant.retireds);
+    }
+}
+
+auto Epoch::getRegistry() -> Registry & {
+    static Registry registry;
+
+    return registry;
+}
+
+auto Epoch::getParticipant() -> Participant & {
+    thread_local Participant participant;
+
+    return participant;
+}
+
+auto Epoch::tryAdvance() -> void {
+    Registry &registry{getRegistry()};
+
+    const std::unique_lock uniqueLock{registry.lock, std::try_to_lock};
+    if (!uniqueLock.owns_lock()) return;
+
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+
+    unsigned long epoch{globalEpoch.load()};
+    for (const Participant *const participant : registry.participants) {
+        if (const unsigned long participantEpoch{participant->epoch.load(std::memory_order::acquire)};
+            participantEpoch != 0 && participantEpoch != epoch)
+            return;
+    }
+    globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+
+    collect(registry.orphans);
+}
+
+auto Epoch::reclaim() -> void {
+    if (Participant & participant{getParticipant()};
+        participant.nesting == 0 && (!participant.retireds.empty() || ++participant.frameCount % collectInterval == 0)) {
+        tryAdvance();
+        collect(participant.retireds);
+    }
+}
+
+auto Epoch::collect(std::vector<Retired> &retireds) noexcept -> void {
+    std::erase_if(retireds, [](const Retired &retired) noexcept {
+        if (!isReclaimable(retired.epoch)) return false;
+
+        retired.deleter(retired.pointer);
+
+        return true;
+    });
+}
+
+constinit std::atomic<unsigned long> Epoch::globalEpoch{1};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+class Epoch {
+    struct Retired {
+        void *pointer;
+        void (*deleter)(void *) noexcept;
+        unsigned long epoch;
+    };
+
+    struct Participant {
+        Participant();
+
+        Participant(const Participant &) = delete;
+
+        Participant(Participant &&) = delete;
+
+        auto operator=(const Participant &) -> Participant & = delete;
+
+        auto operator=(Participant &&) -> Participant & = delete;
+
+        ~Participant();
+
+        std::atomic<unsigned long> epoch;
+        unsigned long nesting{}, frameCount{};
+        std::vector<Retired> retireds;
+    };
+
+    struct Registry {
+        Registry() = default;
+
+        Registry(const Registry &) = delete;
+
+        Registry(Registry &&) = delete;
+
+        auto operator=(const Registry &) -> Registry & = delete;
+
+        auto operator=(Registry &&) -> Registry & = delete;
+
+        ~Registry();
+
+        std::mutex lock;
+        std::vector<Participant *> participants;
+        std::vector<Retired> orphans;
+    };
+
+public:
+    class Guard {
+    public:
+        Guard();
+
+        Guard(const Guard &) = delete;
+
+        Guard(Guard &&) = delete;
+
+        auto operator=(const Guard &) -> Guard & = delete;
+
+        auto operator=(Guard &&) -> Guard & = delete;
+
+        ~Guard();
+    };
+
+    [[nodiscard]] static auto getEpoch() noexcept -> unsigned long;
+
+    [[nodiscard]] static auto isReclaimable(unsigned long epoch) noexcept -> bool;
+
+    static auto retire(void *pointer, void (*deleter)(void *) noexcept) -> void;
+
+    static auto tryAdvance() -> void;
+
+    static auto reclaim() -> void;
+
+private:
+    [[nodiscard]] static auto getRegistry() -> Registry &;
+
+    [[nodiscard]] static auto getParticipant() -> Participant &;
+
+    static auto collect(std::vector<Retired> &retireds) noexcept -> void;
+
+    static constexpr unsigned long collectInterval{64};
+
+    static constinit std::atomic<unsigned long> globalEpoch;
+};
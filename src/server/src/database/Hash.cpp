@@ -0,0 +1,118 @@
+#include "Hash.hpp"
+
+#include "../config/Config.hpp"
+
+auto Hash::size() const noexcept -> unsigned long {
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) return listpack->size() / 2;
+
+    return std::get<Table>(this->value).size();
+}
+
+auto Hash::getMemory() const noexcept -> unsigned long {
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) return listpack->getMemory();
+
+    return this->tableBytes + std::get<Table>(this->value).getMemory();
+}
+
+auto Hash::contains(const std::string_view field) const noexcept -> bool { return this->find(field).has_value(); }
+
+auto Hash::find(const std::string_view field) const noexcept -> std::optional<std::string_view> {
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) {
+        if (auto result{listpack->find(field, 2)}; result != listpack->end()) return *++result;
+
+        return std::nullopt;
+    }
+
+    if (const auto result{std::get<Table>(this->value).find(field)}; result != nullptr) return result->second;
+
+    return std::nullopt;
+}
+
+auto Hash::set(const std::string_view field, const std::string_view value) -> bool {
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) {
+        const unsigned long maxValue{Config::getHashMaxListpackValue()};
+
+        if (auto result{listpack->find(field, 2)}; result != listpack->end()) {
+            if (value.size() <= maxValue) {
+                listpack->replace(++result, value);
+
+                return false;
+            }
+        } else if (listpack->size() / 2 < Config::getHashMaxListpackEntries() && field.size() <= maxValue &&
+                   value.size() <= maxValue) {
+            listpack->insert(listpack->end(), field);
+            listpack->insert(listpack->end(), value);
+
+            return true;
+        }
+
+        this->convert();
+    }
+
+    Table &table{std::get<Table>(this->value)};
+    if (const auto result{table.find(field)}; result != nullptr) {
+        this->tableBytes += value.size() - result->second.size();
+        result->second = value;
+
+        return false;
+    }
+    table.emplace(field, value);
+    this->tableBytes += field.size() + value.size();
+
+    return true;
+}
+
+auto Hash::erase(const std::string_view field) noexcept -> bool {
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) {
+        if (const auto result{listpack->find(field, 2)}; result != listpack->end()) {
+            listpack->erase(listpack->erase(result));
+
+            return true;
+        }
+
+        return false;
+    }
+
+    if (const std::optional result{std::get<Table>(this->value).erase(field)}; result.has_value()) {
+        this->tableBytes -= result->first.size() + result->second.size();
+
+        return true;
+    }
+
+    return false;
+}
+
+auto Hash::traverse(const std::function<auto(std::string_view field, std::string_view value)->void> &action) const
+    -> void {
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) {
+        for (auto iterator{listpack->begin()}; iterator != listpack->end();) {
+            const std::string_view field{*iterator++};
+            action(field, *iterator++);
+        }
+    } else
+        std::get<Table>(this->value).traverse(
+            [&action](const auto &element) { action(element.first, element.second); });
+}
+
+auto Hash::scan(const unsigned long cursor, const unsigned long count,
+                const std::function<auto(std::string_view field, std::string_view value)->void> &action) const
+    -> unsigned long {
+    if (std::holds_alternative<Listpack>(this->value)) {
+        this->traverse(action);
+
+        return 0;
+    }
+
+    return std::get<Table>(this->value).scan(
+        cursor, count, [&action](const auto &element) { action(element.first, element.second); });
+}
+
+auto Hash::convert() -> void {
+    Table table;
+    this->traverse([this, &table](const std::string_view field, const std::string_view value) {
+        table.emplace(field, value);
+        this->tableBytes += field.size() + value.size();
+    });
+
+    this->value = std::move(table);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Dictionary.hpp"
+#include "Listpack.hpp"
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <variant>
+
+class Hash {
+public:
+    [[nodiscard]] auto size() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto contains(std::string_view field) const noexcept -> bool;
+
+    [[nodiscard]] auto find(std::string_view field) const noexcept -> std::optional<std::string_view>;
+
+    auto set(std::string_view field, std::string_view value) -> bool;
+
+    auto erase(std::string_view field) noexcept -> bool;
+
+    auto traverse(const std::function<auto(std::string_view field, std::string_view value)->void> &action) const
+        -> void;
+
+    [[nodiscard]] auto scan(unsigned long cursor, unsigned long count,
+                            const std::function<auto(std::string_view field, std::string_view value)->void> &action)
+        const -> unsigned long;
+
+private:
+    using Table = Dictionary<std::pair<std::string, std::string>>;
+
+    auto convert() -> void;
+
+    std::variant<Listpack, Table> value;
+    unsigned long tableBytes{};
+};
@@ -0,0 +1,146 @@
+#include "HashIndex.hpp"
+
+#include "Epoch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+HashIndex::Table::Table(const unsigned long capacity) : slots(capacity), usedCount{0} {}
+
+HashIndex::HashIndex() : table{new Table{initialCapacity}}, size{0} {}
+
+HashIndex::HashIndex(HashIndex &&other) noexcept :
+    table{other.table.exchange(nullptr)}, size{other.size.exchange(0)} {}
+
+auto HashIndex::operator=(HashIndex &&other) noexcept -> HashIndex & {
+    if (this == &other) return *this;
+
+    delete this->table.load();
+
+    this->table = other.table.exchange(nullptr);
+    this->size = other.size.exchange(0);
+
+    return *this;
+}
+
+HashIndex::~HashIndex() { delete this->table.load(); }
+
+auto HashIndex::find(const std::string_view key) const noexcept -> Node * {
+    const Epoch::Guard guard;
+
+    const Table &table{*this->table.load(std::memory_order::acquire)};
+    const unsigned long hash{Node::hash(key)}, mask{table.slots.size() - 1};
+    for (unsigned long i{hash & mask};; i = (i + 1) & mask) {
+        Node *const node{table.slots[i].load(std::memory_order::acquire)};
+
+        if (node == nullptr) return nullptr;
+        if (!isTombstone(node) && node->getHash() == hash && node->getKey() == key) return node;
+    }
+}
+
+auto HashIndex::insert(Node *const node) -> void {
+    {
+        const Epoch::Guard guard;
+        const std::shared_lock sharedLock{this->lock};
+
+        Table &table{*this->table.load(std::memory_order::acquire)};
+        const unsigned long mask{table.slots.size() - 1};
+
+        unsigned long i{node->getHash() & mask};
+        std::atomic<Node *> *reusableSlot{};
+        for (Node *slotNode{table.slots[i].load(std::memory_order::acquire)}; slotNode != nullptr;
+             i = (i + 1) & mask, slotNode = table.slots[i].load(std::memory_order::acquire))
+            if (reusableSlot == nullptr && isTombstone(slotNode)) reusableSlot = &table.slots[i];
+
+        this->size.fetch_add(1, std::memory_order::relaxed);
+        if (Node *expected{getTombstone()};
+            reusableSlot != nullptr && reusableSlot->compare_exchange_strong(expected, node, std::memory_order::release,
+                                                                             std::memory_order::relaxed))
+            return;
+
+        for (;; i = (i + 1) & mask) {
+            if (Node *expected{}; table.slots[i].compare_exchange_strong(expected, node, std::memory_order::release,
+                                                                        std::memory_order::relaxed))
+                break;
+        }
+        table.usedCount.fetch_add(1, std::memory_order::relaxed);
+
+        if (!this->isOverloaded()) return;
+    }
+
+    this->grow();
+}
+
+auto HashIndex::erase(const std::string_view key) noexcept -> Node * {
+    const Epoch::Guard guard;
+    const std::shared_lock sharedLock{this->lock};
+
+    Table &table{*this->table.load(std::memory_order::acquire)};
+    const unsigned long hash{Node::hash(key)}, mask{table.slots.size() - 1};
+    for (unsigned long i{hash & mask};; i = (i + 1) & mask) {
+        Node *const node{table.slots[i].load(std::memory_order::acquire)};
+
+        if (node == nullptr) return nullptr;
+        if (!isTombstone(node) && node->getHash() == hash && node->getKey() == key) {
+            table.slots[i].store(getTombstone(), std::memory_order::release);
+            this->size.fetch_sub(1, std::memory_order::relaxed);
+
+            return node;
+        }
+    }
+}
+
+auto HashIndex::sample(const unsigned long start, const unsigned long count) const -> std::vector<Node *> {
+    std::vector<Node *> nodes;
+    if (this->size.load(std::memory_order::relaxed) == 0) return nodes;
+
+    const Epoch::Guard guard;
+
+    const Table &table{*this->table.load(std::memory_order::acquire)};
+    const unsigned long mask{table.slots.size() - 1};
+    for (unsigned long i{start & mask}, scanned{}; nodes.size() < count && scanned < table.slots.size();
+         i = (i + 1) & mask, ++scanned) {
+        if (Node *const node{table.slots[i].load(std::memory_order::acquire)}; node != nullptr && !isTombstone(node))
+            nodes.emplace_back(node);
+    }
+
+    return nodes;
+}
+
+auto HashIndex::getTombstone() noexcept -> Node * { return reinterpret_cast<Node *>(alignof(Node)); }
+
+auto HashIndex::isTombstone(const Node *const node) noexcept -> bool { return node == getTombstone(); }
+
+auto HashIndex::deleteTable(void *const table) noexcept -> void { delete static_cast<Table *>(table); }
+
+auto HashIndex::isOverloaded() const noexcept -> bool {
+    const Table &table{*this->table.load(std::memory_order::acquire)};
+
+    return table.usedCount.load(std::memory_order::relaxed) * 4 > table.slots.size() * 3;
+}
+
+auto HashIndex::grow() -> void {
+    const Epoch::Guard guard;
+    const std::lock_guard lockGuard{this->lock};
+
+    if (!this->isOverloaded()) return;
+
+    Table *const oldTable{this->table.load(std::memory_order::relaxed)};
+    const auto newTable{
+        new Table{std::max(initialCapacity, std::bit_ceil(this->size.load(std::memory_order::relaxed) * 4))}
+    };
+    const unsigned long mask{newTable->slots.size() - 1};
+    for (const auto &slot : oldTable->slots) {
+        Node *const node{slot.load(std::memory_order::relaxed)};
+        if (node == nullptr || isTombstone(node)) continue;
+
+        unsigned long i{node->getHash() & mask};
+        while (newTable->slots[i].load(std::memory_order::relaxed) != nullptr) i = (i + 1) & mask;
+        newTable->slots[i].store(node, std::memory_order::relaxed);
+        newTable->usedCount.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    this->table.store(newTable, std::memory_order::release);
+    Epoch::retire(oldTable, deleteTable);
+}
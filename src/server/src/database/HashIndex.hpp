@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Node.hpp"
+
+#include <shared_mutex>
+
+class HashIndex {
+    struct Table {
+        explicit Table(unsigned long capacity);
+
+        std::vector<std::atomic<Node *>> slots;
+        std::atomic<unsigned long> usedCount;
+    };
+
+public:
+    HashIndex();
+
+    HashIndex(const HashIndex &) = delete;
+
+    HashIndex(HashIndex &&) noexcept;
+
+    auto operator=(const HashIndex &) -> HashIndex & = delete;
+
+    auto operator=(HashIndex &&) noexcept -> HashIndex &;
+
+    ~HashIndex();
+
+    [[nodiscard]] auto find(std::string_view key) const noexcept -> Node *;
+
+    auto insert(Node *node) -> void;
+
+    [[nodiscard]] auto erase(std::string_view key) noexcept -> Node *;
+
+    [[nodiscard]] auto sample(unsigned long start, unsigned long count) const -> std::vector<Node *>;
+
+private:
+    [[nodiscard]] static auto getTombstone() noexcept -> Node *;
+
+    [[nodiscard]] static auto isTombstone(const Node *node) noexcept -> bool;
+
+    static auto deleteTable(void *table) noexcept -> void;
+
+    [[nodiscard]] auto isOverloaded() const noexcept -> bool;
+
+    auto grow() -> void;
+
+    static constexpr unsigned long initialCapacity{64};
+
+    std::atomic<Table *> table;
+    std::atomic<unsigned long> size;
+    std::shared_mutex lock;
+};
@@ -0,0 +1,247 @@
+#include "HyperLogLog.hpp"
+
+#include "../config/Config.hpp"
+#include "StringHash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+HyperLogLog::HyperLogLog(std::span<const std::byte> serialization) {
+    const bool isDense{std::to_integer<bool>(serialization.front())};
+    serialization = serialization.subspan(sizeof(isDense));
+
+    if (isDense) {
+        Dense dense{serialization.begin(), serialization.end()};
+        dense.resize(denseSize + densePadding);
+        this->value = std::move(dense);
+    } else {
+        Sparse sparse(serialization.size() / sizeof(Sparse::value_type));
+        std::ranges::copy(serialization.first(sparse.size() * sizeof(Sparse::value_type)),
+                          std::as_writable_bytes(std::span{sparse}).begin());
+        this->value = std::move(sparse);
+    }
+}
+
+auto HyperLogLog::count(const std::span<const HyperLogLog *const> hyperLogLogs) -> unsigned long {
+    Histogram histogram{};
+
+    if (const Sparse *const sparse{hyperLogLogs.size() == 1 ? std::get_if<Sparse>(&hyperLogLogs.front()->value)
+                                                             : nullptr};
+        sparse != nullptr) {
+        histogram.front() = registerCount - sparse->size();
+        for (const unsigned int element : *sparse) ++histogram[element & 0xff];
+    } else {
+        Registers registers{};
+        for (const HyperLogLog *const hyperLogLog : hyperLogLogs) hyperLogLog->maximize(registers);
+
+        for (const unsigned char rank : registers) ++histogram[rank];
+    }
+
+    return estimate(histogram);
+}
+
+auto HyperLogLog::merge(const std::span<const HyperLogLog *const> hyperLogLogs) -> HyperLogLog {
+    Registers registers{};
+    for (const HyperLogLog *const hyperLogLog : hyperLogLogs) hyperLogLog->maximize(registers);
+
+    HyperLogLog result;
+    if (const auto size{static_cast<unsigned long>(std::ranges::count_if(registers, [](const unsigned char rank) {
+            return rank != 0;
+        }))};
+        size * sizeof(Sparse::value_type) <= Config::getHllSparseMaxBytes()) {
+        Sparse sparse;
+        sparse.reserve(size);
+        for (unsigned int i{}; i < registers.size(); ++i)
+            if (registers[i] != 0) sparse.emplace_back(i << 8 | registers[i]);
+
+        result.value = std::move(sparse);
+    } else {
+        Dense dense(denseSize + densePadding);
+        for (unsigned long i{}; i < registers.size(); ++i)
+            if (registers[i] != 0) setRegister(dense, i, registers[i]);
+
+        result.value = std::move(dense);
+    }
+
+    return result;
+}
+
+auto HyperLogLog::getMemory() const noexcept -> unsigned long {
+    if (const auto sparse{std::get_if<Sparse>(&this->value)}; sparse != nullptr)
+        return sparse->capacity() * sizeof(Sparse::value_type);
+
+    return std::get<Dense>(this->value).capacity();
+}
+
+auto HyperLogLog::add(const std::string_view element) -> bool {
+    const unsigned long hashValue{StringHash::murmur(element, hashSeed)};
+    const auto index{static_cast<unsigned int>(hashValue & (registerCount - 1))};
+    const auto rank{static_cast<unsigned char>(std::countr_zero(hashValue >> precision | 1UL << (64 - precision)) + 1)};
+
+    if (const auto sparse{std::get_if<Sparse>(&this->value)}; sparse != nullptr) {
+        const auto position{std::ranges::lower_bound(*sparse, index << 8)};
+        if (position != sparse->end() && *position >> 8 == index) {
+            if ((*position & 0xff) >= rank) return false;
+
+            *position = index << 8 | rank;
+
+            return true;
+        }
+
+        if ((sparse->size() + 1) * sizeof(Sparse::value_type) <= Config::getHllSparseMaxBytes()) {
+            sparse->emplace(position, index << 8 | rank);
+
+            return true;
+        }
+
+        this->convert();
+    }
+
+    Dense &dense{std::get<Dense>(this->value)};
+    if (getRegister(dense, index) >= rank) return false;
+
+    setRegister(dense, index, rank);
+
+    return true;
+}
+
+auto HyperLogLog::serialize() const -> std::vector<std::byte> {
+    std::vector<std::byte> serialization{std::byte{std::holds_alternative<Dense>(this->value)}};
+
+    if (const auto sparse{std::get_if<Sparse>(&this->value)}; sparse != nullptr) {
+        const auto bytes{std::as_bytes(std::span{*sparse})};
+        serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+    } else {
+        const Dense &dense{std::get<Dense>(this->value)};
+        serialization.insert(serialization.cend(), dense.cbegin(), dense.cbegin() + denseSize);
+    }
+
+    return serialization;
+}
+
+auto HyperLogLog::getRegister(const Dense &dense, const unsigned long index) noexcept -> unsigned char {
+    const unsigned long position{index * registerBits}, byte{position / 8};
+    const unsigned int word{std::to_integer<unsigned int>(dense[byte]) |
+                            std::to_integer<unsigned int>(dense[byte + 1]) << 8};
+
+    return word >> position % 8 & ((1U << registerBits) - 1);
+}
+
+auto HyperLogLog::setRegister(Dense &dense, const unsigned long index, const unsigned char rank) noexcept -> void {
+    const unsigned long position{index * registerBits}, byte{position / 8};
+    const unsigned int shift{static_cast<unsigned int>(position % 8)}, mask{((1U << registerBits) - 1) << shift};
+
+    unsigned int word{std::to_integer<unsigned int>(dense[byte]) | std::to_integer<unsigned int>(dense[byte + 1]) << 8};
+    word = (word & ~mask) | static_cast<unsigned int>(rank) << shift;
+
+    dense[byte] = static_cast<std::byte>(word);
+    dense[byte + 1] = static_cast<std::byte>(word >> 8);
+}
+
+auto HyperLogLog::estimate(const Histogram &histogram) noexcept -> unsigned long {
+    constexpr auto count{static_cast<double>(registerCount)};
+
+    const auto sigma{[](double x) {
+        if (x == 1) return std::numeric_limits<double>::infinity();
+
+        double y{1}, z{x}, previous;
+        do {
+            x *= x;
+            previous = z;
+            z += x * y;
+            y += y;
+        } while (previous != z);
+
+        return z;
+    }};
+    const auto tau{[](double x) {
+        if (x == 0 || x == 1) return 0.0;
+
+        double y{1}, z{1 - x}, previous;
+        do {
+            x = std::sqrt(x);
+            previous = z;
+            y *= 0.5;
+            z -= std::pow(1 - x, 2) * y;
+        } while (previous != z);
+
+        return z / 3;
+    }};
+
+    double z{count * tau((count - static_cast<double>(histogram.back())) / count)};
+    for (unsigned long i{maxRank - 1}; i > 0; --i) {
+        z += static_cast<double>(histogram[i]);
+        z *= 0.5;
+    }
+    z += count * sigma(static_cast<double>(histogram.front()) / count);
+
+    return static_cast<unsigned long>(std::llround(0.5 / std::log(2) * count * count / z));
+}
+
+auto HyperLogLog::isAvx2() noexcept -> bool {
+#if defined(__x86_64__)
+    static const bool isSupported{__builtin_cpu_supports("avx2") != 0};
+
+    return isSupported;
+#else
+    return false;
+#endif
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) auto HyperLogLog::maximizeAvx2(const Dense &dense, Registers &registers) noexcept
+    -> void {
+    const __m256i shuffle{_mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5,
+                                           -1, 6, 7, 8, -1, 9, 10, 11, -1)},
+        mask{_mm256_set1_epi32((1 << registerBits) - 1)};
+
+    for (unsigned long i{}; i < registerCount; i += sizeof(__m256i)) {
+        const std::byte *const source{dense.data() + i * registerBits / 8};
+        const __m256i packed{_mm256_shuffle_epi8(
+            _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + sizeof(__m128i) * registerBits / 8)), 1),
+            shuffle)};
+        const __m256i unpacked{_mm256_or_si256(
+            _mm256_or_si256(_mm256_and_si256(packed, mask), _mm256_and_si256(_mm256_slli_epi32(packed, 2),
+                                                                             _mm256_slli_epi32(mask, 8))),
+            _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(packed, 4), _mm256_slli_epi32(mask, 16)),
+                            _mm256_and_si256(_mm256_slli_epi32(packed, 6), _mm256_slli_epi32(mask, 24))))};
+
+        const auto destination{reinterpret_cast<__m256i *>(registers.data() + i)};
+        _mm256_storeu_si256(destination, _mm256_max_epu8(_mm256_loadu_si256(destination), unpacked));
+    }
+}
+#endif
+
+auto HyperLogLog::maximize(Registers &registers) const noexcept -> void {
+    if (const auto sparse{std::get_if<Sparse>(&this->value)}; sparse != nullptr) {
+        for (const unsigned int element : *sparse) {
+            unsigned char &rank{registers[element >> 8]};
+            rank = std::max(rank, static_cast<unsigned char>(element & 0xff));
+        }
+
+        return;
+    }
+
+    const Dense &dense{std::get<Dense>(this->value)};
+#if defined(__x86_64__)
+    if (isAvx2()) return maximizeAvx2(dense, registers);
+#endif
+
+    for (unsigned long i{}; i < registerCount; ++i) registers[i] = std::max(registers[i], getRegister(dense, i));
+}
+
+auto HyperLogLog::convert() -> void {
+    Dense dense(denseSize + densePadding);
+    for (const unsigned int element : std::get<Sparse>(this->value))
+        setRegister(dense, element >> 8, static_cast<unsigned char>(element & 0xff));
+
+    this->value = std::move(dense);
+}
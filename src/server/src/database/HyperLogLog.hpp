@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+class HyperLogLog {
+public:
+    HyperLogLog() = default;
+
+    explicit HyperLogLog(std::span<const std::byte> serialization);
+
+    [[nodiscard]] static auto count(std::span<const HyperLogLog *const> hyperLogLogs) -> unsigned long;
+
+    [[nodiscard]] static auto merge(std::span<const HyperLogLog *const> hyperLogLogs) -> HyperLogLog;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    auto add(std::string_view element) -> bool;
+
+    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+
+private:
+    static constexpr unsigned char precision{14}, registerBits{6}, maxRank{64 - precision + 1};
+    static constexpr unsigned long registerCount{1UL << precision}, denseSize{registerCount * registerBits / 8},
+        densePadding{sizeof(unsigned int)}, hashSeed{0xadc83b19};
+
+    using Sparse = std::vector<unsigned int>;
+    using Dense = std::vector<std::byte>;
+    using Registers = std::array<unsigned char, registerCount>;
+    using Histogram = std::array<unsigned long, maxRank + 1>;
+
+    [[nodiscard]] static auto getRegister(const Dense &dense, unsigned long index) noexcept -> unsigned char;
+
+    static auto setRegister(Dense &dense, unsigned long index, unsigned char rank) noexcept -> void;
+
+    [[nodiscard]] static auto estimate(const Histogram &histogram) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto isAvx2() noexcept -> bool;
+
+#if defined(__x86_64__)
+    static auto maximizeAvx2(const Dense &dense, Registers &registers) noexcept -> void;
+#endif
+
+    auto maximize(Registers &registers) const noexcept -> void;
+
+    auto convert() -> void;
+
+    std::variant<Sparse, Dense> value;
+};
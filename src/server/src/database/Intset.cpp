@@ -0,0 +1,243 @@
+#include "Intset.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+auto Intset::intersect(const Intset &left, const Intset &right) -> Intset {
+    Intset result;
+    std::vector<long> output;
+    merge(left, right,
+          [&result, &output](const std::span<const long> leftBlock, const std::span<const long> rightBlock) {
+              output.resize(std::min(leftBlock.size(), rightBlock.size()));
+              output.resize(intersect(leftBlock, rightBlock, output.data()));
+              result.append(output);
+
+              return true;
+          });
+
+    return result;
+}
+
+auto Intset::intersectCount(const Intset &left, const Intset &right, const unsigned long limit) -> unsigned long {
+    unsigned long count{};
+    merge(left, right, [&count, limit](const std::span<const long> leftBlock, const std::span<const long> rightBlock) {
+        count += intersect(leftBlock, rightBlock, nullptr);
+
+        return limit == 0 || count < limit;
+    });
+
+    return limit != 0 ? std::min(count, limit) : count;
+}
+
+auto Intset::size() const noexcept -> unsigned long { return this->count; }
+
+auto Intset::getMemory() const noexcept -> unsigned long {
+    unsigned long memory{this->blocks.capacity() * sizeof(Block)};
+    for (const Block &block : this->blocks) memory += block.capacity() * sizeof(long);
+
+    return memory;
+}
+
+auto Intset::contains(const long element) const noexcept -> bool {
+    const auto block{this->findBlock(element)};
+
+    return block != this->blocks.cend() && std::ranges::binary_search(*block, element);
+}
+
+auto Intset::insert(const long element) -> bool {
+    if (this->blocks.empty()) {
+        this->blocks.emplace_back(1, element);
+        this->count = 1;
+
+        return true;
+    }
+
+    auto block{this->blocks.begin() + (this->findBlock(element) - this->blocks.cbegin())};
+    if (block == this->blocks.end()) --block;
+
+    const auto result{std::ranges::lower_bound(*block, element)};
+    if (result != block->cend() && *result == element) return false;
+
+    block->emplace(result, element);
+    ++this->count;
+
+    if (block->size() > blockSize) {
+        const auto middle{block->cbegin() + static_cast<long>(block->size() / 2)};
+        Block upper{middle, block->cend()};
+
+        block->erase(middle, block->cend());
+        block->shrink_to_fit();
+        this->blocks.emplace(block + 1, std::move(upper));
+    }
+
+    return true;
+}
+
+auto Intset::erase(const long element) noexcept -> bool {
+    const auto block{this->blocks.begin() + (this->findBlock(element) - this->blocks.cbegin())};
+    if (block == this->blocks.end()) return false;
+
+    const auto result{std::ranges::lower_bound(*block, element)};
+    if (result == block->cend() || *result != element) return false;
+
+    block->erase(result);
+    --this->count;
+    if (block->empty()) this->blocks.erase(block);
+
+    return true;
+}
+
+auto Intset::traverse(const std::function<auto(long element)->void> &action) const -> void {
+    for (const Block &block : this->blocks)
+        for (const long element : block) action(element);
+}
+
+auto Intset::merge(
+    const Intset &left, const Intset &right,
+    const std::function<auto(std::span<const long> leftBlock, std::span<const long> rightBlock)->bool> &action)
+    -> void {
+    for (unsigned long i{}, j{}; i < left.blocks.size() && j < right.blocks.size();) {
+        const Block &leftBlock{left.blocks[i]}, &rightBlock{right.blocks[j]};
+        if (leftBlock.front() <= rightBlock.back() && rightBlock.front() <= leftBlock.back() &&
+            !action(leftBlock, rightBlock))
+            return;
+
+        if (leftBlock.back() <= rightBlock.back()) ++i;
+        if (rightBlock.back() <= leftBlock.back()) ++j;
+    }
+}
+
+auto Intset::findBlock(const long element) const noexcept -> std::vector<Block>::const_iterator {
+    return std::ranges::lower_bound(this->blocks, element, {}, [](const Block &block) { return block.back(); });
+}
+
+auto Intset::append(std::span<const long> elements) -> void {
+    while (!elements.empty()) {
+        if (this->blocks.empty() || this->blocks.back().size() == blockSize) this->blocks.emplace_back();
+
+        Block &block{this->blocks.back()};
+        const unsigned long size{std::min(elements.size(), blockSize - block.size())};
+        block.insert(block.cend(), elements.begin(), elements.begin() + static_cast<long>(size));
+
+        elements = elements.subspan(size);
+        this->count += size;
+    }
+}
+
+auto Intset::intersect(std::span<const long> left, std::span<const long> right, long *const output) noexcept
+    -> unsigned long {
+    if (left.size() > right.size()) std::swap(left, right);
+    if (left.empty()) return 0;
+
+    if (right.size() / left.size() >= gallopingRatio) return intersectGalloping(left, right, output);
+
+    static const Kernel kernel{selectKernel()};
+
+    return kernel(left.data(), left.size(), right.data(), right.size(), output);
+}
+
+auto Intset::selectKernel() noexcept -> Kernel {
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx2")) return intersectAvx2;
+    if (__builtin_cpu_supports("sse4.1")) return intersectSse;
+#endif
+
+    return intersectScalar;
+}
+
+auto Intset::intersectScalar(const long *const left, const unsigned long leftSize, const long *const right,
+                             const unsigned long rightSize, long *const output) noexcept -> unsigned long {
+    unsigned long i{}, j{}, count{};
+    while (i < leftSize && j < rightSize) {
+        if (left[i] < right[j]) ++i;
+        else if (right[j] < left[i]) ++j;
+        else {
+            if (output != nullptr) output[count] = left[i];
+            ++count;
+            ++i;
+            ++j;
+        }
+    }
+
+    return count;
+}
+
+auto Intset::intersectGalloping(const std::span<const long> left, std::span<const long> right,
+                                long *const output) noexcept -> unsigned long {
+    unsigned long count{};
+    for (const long element : left) {
+        unsigned long bound{1};
+        while (bound < right.size() && right[bound] < element) bound <<= 1;
+
+        const auto result{std::lower_bound(right.begin(), right.begin() + std::min(bound + 1, right.size()), element)};
+        right = right.subspan(result - right.begin());
+        if (right.empty()) break;
+
+        if (right.front() == element) {
+            if (output != nullptr) output[count] = element;
+            ++count;
+            right = right.subspan(1);
+        }
+    }
+
+    return count;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.1"))) auto Intset::intersectSse(const long *const left, const unsigned long leftSize,
+                                                             const long *const right, const unsigned long rightSize,
+                                                             long *const output) noexcept -> unsigned long {
+    unsigned long i{}, j{}, count{};
+    while (i + 2 <= leftSize && j + 2 <= rightSize) {
+        const __m128i leftBlock{_mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i))},
+            rightBlock{_mm_loadu_si128(reinterpret_cast<const __m128i *>(right + j))};
+
+        const __m128i equal{_mm_or_si128(_mm_cmpeq_epi64(leftBlock, rightBlock),
+                                         _mm_cmpeq_epi64(leftBlock, _mm_shuffle_epi32(rightBlock, 0b01001110)))};
+        for (auto mask{static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(equal)))}; mask != 0;
+             mask &= mask - 1) {
+            if (output != nullptr) output[count] = left[i + std::countr_zero(mask)];
+            ++count;
+        }
+
+        const long leftMax{left[i + 1]}, rightMax{right[j + 1]};
+        if (leftMax <= rightMax) i += 2;
+        if (rightMax <= leftMax) j += 2;
+    }
+
+    return count + intersectScalar(left + i, leftSize - i, right + j, rightSize - j,
+                                   output != nullptr ? output + count : nullptr);
+}
+
+__attribute__((target("avx2"))) auto Intset::intersectAvx2(const long *const left, const unsigned long leftSize,
+                                                           const long *const right, const unsigned long rightSize,
+                                                           long *const output) noexcept -> unsigned long {
+    unsigned long i{}, j{}, count{};
+    while (i + 4 <= leftSize && j + 4 <= rightSize) {
+        const __m256i leftBlock{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + i))},
+            rightBlock{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + j))};
+
+        const __m256i equal{_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi64(leftBlock, rightBlock),
+                            _mm256_cmpeq_epi64(leftBlock, _mm256_permute4x64_epi64(rightBlock, 0b00111001))),
+            _mm256_or_si256(_mm256_cmpeq_epi64(leftBlock, _mm256_permute4x64_epi64(rightBlock, 0b01001110)),
+                            _mm256_cmpeq_epi64(leftBlock, _mm256_permute4x64_epi64(rightBlock, 0b10010011))))};
+        for (auto mask{static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)))}; mask != 0;
+             mask &= mask - 1) {
+            if (output != nullptr) output[count] = left[i + std::countr_zero(mask)];
+            ++count;
+        }
+
+        const long leftMax{left[i + 3]}, rightMax{right[j + 3]};
+        if (leftMax <= rightMax) i += 4;
+        if (rightMax <= leftMax) j += 4;
+    }
+
+    return count + intersectScalar(left + i, leftSize - i, right + j, rightSize - j,
+                                   output != nullptr ? output + count : nullptr);
+}
+#endif
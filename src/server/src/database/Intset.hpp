@@ -0,0 +1,67 @@
+#pragma once
+
+#include <functional>
+#include <span>
+#include <vector>
+
+class Intset {
+public:
+    using Kernel = auto (*)(const long *left, unsigned long leftSize, const long *right, unsigned long rightSize,
+                            long *output) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto intersect(const Intset &left, const Intset &right) -> Intset;
+
+    [[nodiscard]] static auto intersectCount(const Intset &left, const Intset &right, unsigned long limit)
+        -> unsigned long;
+
+    Intset() = default;
+
+    [[nodiscard]] auto size() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto contains(long element) const noexcept -> bool;
+
+    auto insert(long element) -> bool;
+
+    auto erase(long element) noexcept -> bool;
+
+    auto traverse(const std::function<auto(long element)->void> &action) const -> void;
+
+    [[nodiscard]] static auto intersectScalar(const long *left, unsigned long leftSize, const long *right,
+                                              unsigned long rightSize, long *output) noexcept -> unsigned long;
+
+#if defined(__x86_64__)
+    [[nodiscard]] static auto intersectSse(const long *left, unsigned long leftSize, const long *right,
+                                           unsigned long rightSize, long *output) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto intersectAvx2(const long *left, unsigned long leftSize, const long *right,
+                                            unsigned long rightSize, long *output) noexcept -> unsigned long;
+#endif
+
+    static constexpr unsigned long blockSize{1024};
+
+private:
+    using Block = std::vector<long>;
+
+    static auto merge(const Intset &left, const Intset &right,
+                      const std::function<auto(std::span<const long> leftBlock, std::span<const long> rightBlock)->bool>
+                          &action) -> void;
+
+    [[nodiscard]] static auto intersect(std::span<const long> left, std::span<const long> right, long *output) noexcept
+        -> unsigned long;
+
+    [[nodiscard]] static auto selectKernel() noexcept -> Kernel;
+
+    [[nodiscard]] static auto intersectGalloping(std::span<const long> left, std::span<const long> right,
+                                                 long *output) noexcept -> unsigned long;
+
+    [[nodiscard]] auto findBlock(long element) const noexcept -> std::vector<Block>::const_iterator;
+
+    auto append(std::span<const long> elements) -> void;
+
+    static constexpr unsigned long gallopingRatio{32};
+
+    std::vector<Block> blocks;
+    unsigned long count{};
+};
@@ -0,0 +1,205 @@
+#include "List.hpp"
+
+#include "../config/Config.hpp"
+
+#include <string>
+#include <utility>
+
+auto List::size() const noexcept -> unsigned long { return this->length; }
+
+auto List::getMemory() const noexcept -> unsigned long {
+    unsigned long memory{this->chunks.size() * (sizeof(Listpack) + sizeof(void *) * 2)};
+    for (const auto &chunk : this->chunks) memory += chunk.getMemory();
+
+    return memory;
+}
+
+auto List::at(unsigned long index) const noexcept -> std::string_view { return this->getChunk(index)->at(index); }
+
+auto List::set(unsigned long index, const std::string_view element) -> void {
+    Listpack &chunk{*this->getChunk(index)};
+
+    Listpack::Iterator position{chunk.begin()};
+    while (index-- > 0) ++position;
+    chunk.replace(position, element);
+}
+
+auto List::pushFront(const std::string_view element) -> void {
+    if (this->chunks.empty() || !isInsertable(this->chunks.front(), element)) this->chunks.emplace_front();
+
+    Listpack &chunk{this->chunks.front()};
+    chunk.insert(chunk.begin(), element);
+    ++this->length;
+}
+
+auto List::pushBack(const std::string_view element) -> void {
+    if (this->chunks.empty() || !isInsertable(this->chunks.back(), element)) this->chunks.emplace_back();
+
+    Listpack &chunk{this->chunks.back()};
+    chunk.insert(chunk.end(), element);
+    ++this->length;
+}
+
+auto List::popFront() -> std::string {
+    Listpack &chunk{this->chunks.front()};
+    std::string element{*chunk.begin()};
+
+    chunk.erase(chunk.begin());
+    if (chunk.size() == 0) this->chunks.pop_front();
+    --this->length;
+
+    return element;
+}
+
+auto List::popBack() -> std::string {
+    Listpack &chunk{this->chunks.back()};
+    Listpack::Iterator position{chunk.begin()};
+    for (unsigned long i{1}; i < chunk.size(); ++i) ++position;
+    std::string element{*position};
+
+    chunk.erase(position);
+    if (chunk.size() == 0) this->chunks.pop_back();
+    --this->length;
+
+    return element;
+}
+
+auto List::insert(const std::string_view pivot, const std::string_view element, const bool isBefore) -> bool {
+    for (auto chunk{this->chunks.begin()}; chunk != this->chunks.end(); ++chunk) {
+        Listpack::Iterator position{chunk->find(pivot)};
+        if (position == chunk->end()) continue;
+
+        if (!isBefore) ++position;
+        chunk->insert(position, element);
+        ++this->length;
+
+        if (const unsigned long chunkSize{chunk->size()}; chunkSize > Config::getListMaxListpackEntries()) {
+            Listpack::Iterator middle{chunk->begin()};
+            for (unsigned long i{}; i < chunkSize / 2; ++i) ++middle;
+
+            this->chunks.emplace(std::next(chunk), chunk->split(middle));
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+auto List::remove(const std::string_view element, const long count) noexcept -> unsigned long {
+    unsigned long skip{}, limit{static_cast<unsigned long>(count < 0 ? -count : count)};
+    if (count < 0) {
+        unsigned long matches{};
+        this->traverse([element, &matches](const std::string_view other) { matches += other == element; });
+
+        skip = matches > limit ? matches - limit : 0;
+        limit = 0;
+    }
+
+    unsigned long removed{};
+    for (auto chunk{this->chunks.begin()}; chunk != this->chunks.end() && (limit == 0 || removed < limit);) {
+        for (Listpack::Iterator position{chunk->begin()};
+             position != chunk->end() && (limit == 0 || removed < limit);) {
+            if (*position != element) ++position;
+            else if (skip > 0) {
+                --skip;
+                ++position;
+            } else {
+                position = chunk->erase(position);
+                ++removed;
+            }
+        }
+
+        if (chunk->size() == 0) chunk = this->chunks.erase(chunk);
+        else ++chunk;
+    }
+    this->length -= removed;
+
+    return removed;
+}
+
+auto List::trim(const unsigned long start, const unsigned long end) noexcept -> void {
+    this->eraseBack(this->length - 1 - end);
+    this->eraseFront(start);
+}
+
+auto List::range(unsigned long start, const unsigned long end,
+                 const std::function<auto(std::string_view element)->void> &action) const -> void {
+    unsigned long remaining{end - start + 1};
+    auto chunk{this->getChunk(start)};
+
+    Listpack::Iterator position{chunk->begin()};
+    while (start-- > 0) ++position;
+
+    while (remaining > 0) {
+        if (position == chunk->end()) position = (++chunk)->begin();
+
+        action(*position++);
+        --remaining;
+    }
+}
+
+auto List::traverse(const std::function<auto(std::string_view element)->void> &action) const -> void {
+    for (const Listpack &chunk : this->chunks)
+        for (const std::string_view element : chunk) action(element);
+}
+
+auto List::isInsertable(const Listpack &chunk, const std::string_view element) noexcept -> bool {
+    return chunk.size() < Config::getListMaxListpackEntries() && element.size() <= Config::getListMaxListpackValue();
+}
+
+auto List::getChunk(unsigned long &index) const noexcept -> std::list<Listpack>::const_iterator {
+    if (index < this->length / 2) {
+        auto chunk{this->chunks.cbegin()};
+        for (; index >= chunk->size(); ++chunk) index -= chunk->size();
+
+        return chunk;
+    }
+
+    auto chunk{std::prev(this->chunks.cend())};
+    unsigned long remaining{this->length - index};
+    for (; remaining > chunk->size(); --chunk) remaining -= chunk->size();
+    index = chunk->size() - remaining;
+
+    return chunk;
+}
+
+auto List::getChunk(unsigned long &index) noexcept -> std::list<Listpack>::iterator {
+    const auto chunk{std::as_const(*this).getChunk(index)};
+
+    return this->chunks.erase(chunk, chunk);
+}
+
+auto List::eraseFront(unsigned long count) noexcept -> void {
+    this->length -= count;
+
+    while (count > 0 && count >= this->chunks.front().size()) {
+        count -= this->chunks.front().size();
+        this->chunks.pop_front();
+    }
+
+    if (count > 0) {
+        Listpack &chunk{this->chunks.front()};
+
+        Listpack::Iterator last{chunk.begin()};
+        for (unsigned long i{}; i < count; ++i) ++last;
+        chunk.erase(chunk.begin(), last);
+    }
+}
+
+auto List::eraseBack(unsigned long count) noexcept -> void {
+    this->length -= count;
+
+    while (count > 0 && count >= this->chunks.back().size()) {
+        count -= this->chunks.back().size();
+        this->chunks.pop_back();
+    }
+
+    if (count > 0) {
+        Listpack &chunk{this->chunks.back()};
+
+        Listpack::Iterator first{chunk.begin()};
+        for (unsigned long i{count}; i < chunk.size(); ++i) ++first;
+        chunk.erase(first, chunk.end());
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Listpack.hpp"
+
+#include <functional>
+#include <list>
+
+class List {
+public:
+    [[nodiscard]] auto size() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto at(unsigned long index) const noexcept -> std::string_view;
+
+    auto set(unsigned long index, std::string_view element) -> void;
+
+    auto pushFront(std::string_view element) -> void;
+
+    auto pushBack(std::string_view element) -> void;
+
+    [[nodiscard]] auto popFront() -> std::string;
+
+    [[nodiscard]] auto popBack() -> std::string;
+
+    auto insert(std::string_view pivot, std::string_view element, bool isBefore) -> bool;
+
+    auto remove(std::string_view element, long count) noexcept -> unsigned long;
+
+    auto trim(unsigned long start, unsigned long end) noexcept -> void;
+
+    auto range(unsigned long start, unsigned long end,
+               const std::function<auto(std::string_view element)->void> &action) const -> void;
+
+    auto traverse(const std::function<auto(std::string_view element)->void> &action) const -> void;
+
+private:
+    [[nodiscard]] static auto isInsertable(const Listpack &chunk, std::string_view element) noexcept -> bool;
+
+    [[nodiscard]] auto getChunk(unsigned long &index) const noexcept -> std::list<Listpack>::const_iterator;
+
+    [[nodiscard]] auto getChunk(unsigned long &index) noexcept -> std::list<Listpack>::iterator;
+
+    auto eraseFront(unsigned long count) noexcept -> void;
+
+    auto eraseBack(unsigned long count) noexcept -> void;
+
+    std::list<Listpack> chunks;
+    unsigned long length{};
+};
@@ -0,0 +1,128 @@
+#include "Listpack.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+Listpack::Iterator::Iterator(const std::byte *const position) noexcept : position{position} {}
+
+auto Listpack::Iterator::operator*() const noexcept -> std::string_view {
+    const std::byte *position{this->position};
+    const unsigned long size{decodeSize(position)};
+
+    return {reinterpret_cast<const char *>(position), size};
+}
+
+auto Listpack::Iterator::operator++() noexcept -> Iterator & {
+    const unsigned long size{decodeSize(this->position)};
+    this->position += size;
+
+    return *this;
+}
+
+auto Listpack::Iterator::operator++(int) noexcept -> Iterator {
+    const Iterator iterator{*this};
+    ++*this;
+
+    return iterator;
+}
+
+auto Listpack::Iterator::getPosition() const noexcept -> const std::byte * { return this->position; }
+
+auto Listpack::begin() const noexcept -> Iterator { return Iterator{this->buffer.data()}; }
+
+auto Listpack::end() const noexcept -> Iterator { return Iterator{this->buffer.data() + this->buffer.size()}; }
+
+auto Listpack::size() const noexcept -> unsigned long { return this->count; }
+
+auto Listpack::getMemory() const noexcept -> unsigned long { return this->buffer.capacity(); }
+
+auto Listpack::at(unsigned long index) const noexcept -> std::string_view {
+    Iterator iterator{this->begin()};
+    while (index-- > 0) ++iterator;
+
+    return *iterator;
+}
+
+auto Listpack::find(const std::string_view element, const unsigned long step) const noexcept -> Iterator {
+    const Iterator end{this->end()};
+    for (Iterator iterator{this->begin()}; iterator != end;) {
+        if (*iterator == element) return iterator;
+
+        for (unsigned long i{}; i < step; ++i) ++iterator;
+    }
+
+    return end;
+}
+
+auto Listpack::insert(const Iterator position, const std::string_view element) -> Iterator {
+    std::array<std::byte, (sizeof(unsigned long) * 8 + 6) / 7> header;
+    unsigned long headerSize{};
+    for (unsigned long size{element.size()};;) {
+        header[headerSize++] = static_cast<std::byte>((size & 0x7f) | (size > 0x7f ? 0x80 : 0));
+        size >>= 7;
+
+        if (size == 0) break;
+    }
+
+    const unsigned long offset{this->getOffset(position)};
+    const auto destination{this->buffer.insert(this->buffer.cbegin() + static_cast<long>(offset),
+                                               headerSize + element.size(), std::byte{})};
+    std::ranges::copy(std::span{header}.first(headerSize), destination);
+    std::ranges::copy(std::as_bytes(std::span{element}), destination + static_cast<long>(headerSize));
+    ++this->count;
+
+    return Iterator{this->buffer.data() + offset};
+}
+
+auto Listpack::erase(const Iterator position) noexcept -> Iterator {
+    Iterator next{position};
+    const unsigned long offset{this->getOffset(position)}, size{this->getOffset(++next) - offset};
+
+    const auto first{this->buffer.cbegin() + static_cast<long>(offset)};
+    this->buffer.erase(first, first + static_cast<long>(size));
+    --this->count;
+
+    return Iterator{this->buffer.data() + offset};
+}
+
+auto Listpack::erase(const Iterator first, const Iterator last) noexcept -> Iterator {
+    for (Iterator iterator{first}; iterator != last; ++iterator) --this->count;
+
+    const unsigned long offset{this->getOffset(first)};
+    this->buffer.erase(this->buffer.cbegin() + static_cast<long>(offset),
+                       this->buffer.cbegin() + static_cast<long>(this->getOffset(last)));
+
+    return Iterator{this->buffer.data() + offset};
+}
+
+auto Listpack::replace(const Iterator position, const std::string_view element) -> Iterator {
+    return this->insert(this->erase(position), element);
+}
+
+auto Listpack::split(const Iterator position) -> Listpack {
+    Listpack listpack;
+    listpack.buffer.assign(this->buffer.cbegin() + static_cast<long>(this->getOffset(position)), this->buffer.cend());
+    listpack.count = this->count;
+
+    this->erase(position, this->end());
+    listpack.count -= this->count;
+
+    return listpack;
+}
+
+auto Listpack::decodeSize(const std::byte *&position) noexcept -> unsigned long {
+    unsigned long size{};
+    for (unsigned char shift{};; shift += 7) {
+        const auto byte{std::to_integer<unsigned long>(*position++)};
+        size |= (byte & 0x7f) << shift;
+
+        if (!(byte & 0x80)) break;
+    }
+
+    return size;
+}
+
+auto Listpack::getOffset(const Iterator position) const noexcept -> unsigned long {
+    return position.getPosition() - this->buffer.data();
+}
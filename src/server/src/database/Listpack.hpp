@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+class Listpack {
+public:
+    class Iterator {
+    public:
+        Iterator() = default;
+
+        explicit Iterator(const std::byte *position) noexcept;
+
+        [[nodiscard]] auto operator*() const noexcept -> std::string_view;
+
+        auto operator++() noexcept -> Iterator &;
+
+        auto operator++(int) noexcept -> Iterator;
+
+        [[nodiscard]] auto operator==(const Iterator &) const noexcept -> bool = default;
+
+        [[nodiscard]] auto getPosition() const noexcept -> const std::byte *;
+
+    private:
+        const std::byte *position{};
+    };
+
+    [[nodiscard]] auto begin() const noexcept -> Iterator;
+
+    [[nodiscard]] auto end() const noexcept -> Iterator;
+
+    [[nodiscard]] auto size() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto at(unsigned long index) const noexcept -> std::string_view;
+
+    [[nodiscard]] auto find(std::string_view element, unsigned long step = 1) const noexcept -> Iterator;
+
+    auto insert(Iterator position, std::string_view element) -> Iterator;
+
+    auto erase(Iterator position) noexcept -> Iterator;
+
+    auto erase(Iterator first, Iterator last) noexcept -> Iterator;
+
+    auto replace(Iterator position, std::string_view element) -> Iterator;
+
+    [[nodiscard]] auto split(Iterator position) -> Listpack;
+
+private:
+    [[nodiscard]] static auto decodeSize(const std::byte *&position) noexcept -> unsigned long;
+
+    [[nodiscard]] auto getOffset(Iterator position) const noexcept -> unsigned long;
+
+    std::vector<std::byte> buffer;
+    unsigned long count{};
+};
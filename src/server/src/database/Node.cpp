@@ -0,0 +1,89 @@
+#include "Node.hpp"
+
+#include "Arena.hpp"
+#include "Epoch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+auto Node::create(Arena &arena, const std::string_view key, Entry &&entry, const unsigned char level) -> Node * {
+    const auto keySize{static_cast<unsigned int>(key.size())};
+    const auto node{new (arena.allocate(getSize(keySize, level)))
+                        Node{getPrefix(key), hash(key), keySize, level, std::move(entry)}};
+
+    for (std::atomic<Node *> &next : node->getNext()) new (&next) std::atomic<Node *>{};
+    std::ranges::copy(key, reinterpret_cast<char *>(node->getNext().data() + node->level + 1));
+
+    return node;
+}
+
+auto Node::destroy(Arena &arena, Node *const node) noexcept -> void {
+    const unsigned long size{node->getSize()};
+    destruct(node);
+    arena.deallocate(node, size);
+}
+
+auto Node::retire(Arena &arena, Node *const node) -> void { arena.retire(node, node->getSize(), destruct); }
+
+auto Node::hash(const std::string_view key) noexcept -> unsigned long { return std::hash<std::string_view>{}(key); }
+
+auto Node::getPrefix(const std::string_view key) noexcept -> unsigned long {
+    std::array<char, sizeof(unsigned long)> bytes{};
+    std::ranges::copy(key.substr(0, bytes.size()), bytes.begin());
+
+    const auto prefix{std::bit_cast<unsigned long>(bytes)};
+    if constexpr (std::endian::native == std::endian::little) return std::byteswap(prefix);
+    else return prefix;
+}
+
+auto Node::getHash() const noexcept -> unsigned long { return this->keyHash; }
+
+auto Node::getKey() const noexcept -> std::string_view {
+    return {reinterpret_cast<const char *>(reinterpret_cast<const std::atomic<Node *> *>(this + 1) + this->level + 1),
+            this->keySize};
+}
+
+auto Node::compare(const unsigned long prefix, const std::string_view key) const noexcept -> std::strong_ordering {
+    if (this->prefix != prefix) return this->prefix <=> prefix;
+
+    return this->getKey() <=> key;
+}
+
+auto Node::getEntry() noexcept -> Entry & { return *this->entry.load(std::memory_order::acquire); }
+
+auto Node::setEntry(Entry &&entry) -> void {
+    Epoch::retire(this->entry.exchange(new Entry{std::move(entry)}, std::memory_order::acq_rel), deleteEntry);
+}
+
+auto Node::getNext() noexcept -> std::span<std::atomic<Node *>> {
+    return {reinterpret_cast<std::atomic<Node *> *>(this + 1), this->level + 1UL};
+}
+
+auto Node::claim(const unsigned long version) noexcept -> bool {
+    unsigned long expected{this->version.load(std::memory_order::relaxed)};
+    while (expected < version)
+        if (this->version.compare_exchange_weak(expected, version, std::memory_order::relaxed)) return true;
+
+    return false;
+}
+
+auto Node::setVersion(const unsigned long version) noexcept -> void {
+    this->version.store(version, std::memory_order::relaxed);
+}
+
+Node::Node(const unsigned long prefix, const unsigned long keyHash, const unsigned int keySize,
+           const unsigned char level, Entry &&entry) :
+    prefix{prefix}, keyHash{keyHash}, version{0}, keySize{keySize}, level{level}, entry{new Entry{std::move(entry)}} {}
+
+Node::~Node() { delete this->entry.load(std::memory_order::relaxed); }
+
+auto Node::getSize(const unsigned int keySize, const unsigned char level) noexcept -> unsigned long {
+    return sizeof(Node) + (level + 1) * sizeof(std::atomic<Node *>) + keySize;
+}
+
+auto Node::destruct(void *const node) noexcept -> void { static_cast<Node *>(node)->~Node(); }
+
+auto Node::deleteEntry(void *const entry) noexcept -> void { delete static_cast<Entry *>(entry); }
+
+auto Node::getSize() const noexcept -> unsigned long { return getSize(this->keySize, this->level); }
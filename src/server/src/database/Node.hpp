@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Entry.hpp"
+
+#include <atomic>
+#include <compare>
+
+class Arena;
+
+class Node {
+public:
+    [[nodiscard]] static auto create(Arena &arena, std::string_view key, Entry &&entry, unsigned char level) -> Node *;
+
+    static auto destroy(Arena &arena, Node *node) noexcept -> void;
+
+    static auto retire(Arena &arena, Node *node) -> void;
+
+    [[nodiscard]] static auto hash(std::string_view key) noexcept -> unsigned long;
+
+    [[nodiscard]] static auto getPrefix(std::string_view key) noexcept -> unsigned long;
+
+    Node(const Node &) = delete;
+
+    Node(Node &&) = delete;
+
+    auto operator=(const Node &) -> Node & = delete;
+
+    auto operator=(Node &&) -> Node & = delete;
+
+    [[nodiscard]] auto getHash() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getKey() const noexcept -> std::string_view;
+
+    [[nodiscard]] auto compare(unsigned long prefix, std::string_view key) const noexcept -> std::strong_ordering;
+
+    [[nodiscard]] auto getEntry() noexcept -> Entry &;
+
+    auto setEntry(Entry &&entry) -> void;
+
+    [[nodiscard]] auto getNext() noexcept -> std::span<std::atomic<Node *>>;
+
+    [[nodiscard]] auto claim(unsigned long version) noexcept -> bool;
+
+    auto setVersion(unsigned long version) noexcept -> void;
+
+private:
+    Node(unsigned long prefix, unsigned long keyHash, unsigned int keySize, unsigned char level, Entry &&entry);
+
+    ~Node();
+
+    [[nodiscard]] static auto getSize(unsigned int keySize, unsigned char level) noexcept -> unsigned long;
+
+    static auto destruct(void *node) noexcept -> void;
+
+    static auto deleteEntry(void *entry) noexcept -> void;
+
+    [[nodiscard]] auto getSize() const noexcept -> unsigned long;
+
+    unsigned long prefix, keyHash;
+    std::atomic<unsigned long> version;
+    unsigned int keySize;
+    unsigned char level;
+    std::atomic<Entry *> entry;
+};
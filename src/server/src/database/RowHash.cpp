@@ -0,0 +1,71 @@
+#include "RowHash.hpp"
+
+#include "../config/Config.hpp"
+
+#include <limits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+auto RowHash::isCreatable(const unsigned long width, const unsigned long depth, const unsigned long cellSize) noexcept
+    -> bool {
+    return width > 0 && depth > 0 && width <= std::numeric_limits<unsigned int>::max() / depth &&
+           width * depth <= Config::getMaxAllocation() / cellSize;
+}
+
+auto RowHash::hash(const unsigned long hash, const unsigned int width, const std::span<unsigned int> offsets) noexcept
+    -> void {
+    const auto first{static_cast<unsigned int>(hash)}, second{static_cast<unsigned int>(hash >> 32) | 1};
+
+    unsigned int row{};
+#if defined(__x86_64__)
+    if (isAvx2()) row = hashAvx2(first, second, width, offsets);
+#endif
+
+    hashScalar(first, second, width, row, offsets);
+}
+
+auto RowHash::isAvx2() noexcept -> bool {
+#if defined(__x86_64__)
+    static const bool isSupported{__builtin_cpu_supports("avx2") != 0};
+
+    return isSupported;
+#else
+    return false;
+#endif
+}
+
+auto RowHash::hashScalar(const unsigned int first, const unsigned int second, const unsigned int width,
+                         unsigned int row, const std::span<unsigned int> offsets) noexcept -> void {
+    for (; row < offsets.size(); ++row) {
+        const unsigned int rowHash{first + row * second};
+        offsets[row] = row * width + static_cast<unsigned int>(static_cast<unsigned long>(rowHash) * width >> 32);
+    }
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) auto RowHash::hashAvx2(const unsigned int first, const unsigned int second,
+                                                       const unsigned int width,
+                                                       const std::span<unsigned int> offsets) noexcept
+    -> unsigned int {
+    const __m256i firsts{_mm256_set1_epi32(static_cast<int>(first))},
+        seconds{_mm256_set1_epi32(static_cast<int>(second))}, widths{_mm256_set1_epi32(static_cast<int>(width))},
+        step{_mm256_set1_epi32(8)};
+    __m256i rows{_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)};
+
+    unsigned int row{};
+    for (; row + 8 <= offsets.size(); row += 8) {
+        const __m256i rowHashes{_mm256_add_epi32(firsts, _mm256_mullo_epi32(rows, seconds))};
+        const __m256i even{_mm256_srli_epi64(_mm256_mul_epu32(rowHashes, widths), 32)},
+            odd{_mm256_mul_epu32(_mm256_srli_epi64(rowHashes, 32), widths)};
+        const __m256i columns{_mm256_blend_epi32(even, odd, 0b10101010)};
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(offsets.data() + row),
+                            _mm256_add_epi32(_mm256_mullo_epi32(rows, widths), columns));
+        rows = _mm256_add_epi32(rows, step);
+    }
+
+    return row;
+}
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <span>
+
+class RowHash {
+public:
+    [[nodiscard]] static auto isCreatable(unsigned long width, unsigned long depth, unsigned long cellSize) noexcept
+        -> bool;
+
+    static auto hash(unsigned long hash, unsigned int width, std::span<unsigned int> offsets) noexcept -> void;
+
+private:
+    [[nodiscard]] static auto isAvx2() noexcept -> bool;
+
+    static auto hashScalar(unsigned int first, unsigned int second, unsigned int width, unsigned int row,
+                           std::span<unsigned int> offsets) noexcept -> void;
+
+#if defined(__x86_64__)
+    static auto hashAvx2(unsigned int first, unsigned int second, unsigned int width,
+                         std::span<unsigned int> offsets) noexcept -> unsigned int;
+#endif
+};
@@ -0,0 +1,215 @@
+#include "Set.hpp"
+
+#include "../config/Config.hpp"
+#include "Entry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <limits>
+#include <ranges>
+
+auto Set::intersect(const std::span<const Set *const> sets) -> Set {
+    Set result;
+    if (sets.empty()) return result;
+
+    const std::vector sortedSets{sortBySize(sets)};
+    if (isIntsets(sortedSets)) {
+        Intset intset{std::get<Intset>(sortedSets.front()->value)};
+        for (unsigned long i{1}; i < sortedSets.size() && intset.size() != 0; ++i)
+            intset = Intset::intersect(intset, std::get<Intset>(sortedSets[i]->value));
+        result.value = std::move(intset);
+
+        return result;
+    }
+
+    sortedSets.front()->traverse([&sortedSets, &result](const std::string_view element) {
+        if (std::ranges::all_of(sortedSets | std::views::drop(1),
+                                [element](const Set *const set) { return set->contains(element); }))
+            result.insert(element);
+    });
+
+    return result;
+}
+
+auto Set::intersectCount(const std::span<const Set *const> sets, const unsigned long limit) -> unsigned long {
+    if (sets.empty()) return 0;
+
+    const std::vector sortedSets{sortBySize(sets)};
+    unsigned long count{};
+    if (isIntsets(sortedSets) && sortedSets.size() > 1) {
+        const Intset *intset{&std::get<Intset>(sortedSets.front()->value)};
+        Intset intersection;
+        for (unsigned long i{1}; i + 1 < sortedSets.size() && intset->size() != 0; ++i) {
+            intersection = Intset::intersect(*intset, std::get<Intset>(sortedSets[i]->value));
+            intset = &intersection;
+        }
+        count = Intset::intersectCount(*intset, std::get<Intset>(sortedSets.back()->value), limit);
+    } else {
+        unsigned long cursor{};
+        do {
+            cursor = sortedSets.front()->scan(
+                cursor, intersectBatchSize, [&sortedSets, &count](const std::string_view element) {
+                    count += std::ranges::all_of(sortedSets | std::views::drop(1),
+                                                 [element](const Set *const set) { return set->contains(element); });
+                });
+        } while (cursor != 0 && (limit == 0 || count < limit));
+    }
+
+    return limit != 0 ? std::min(count, limit) : count;
+}
+
+auto Set::unite(const std::span<const Set *const> sets) -> Set {
+    Set result;
+    for (const Set *const set : sets)
+        set->traverse([&result](const std::string_view element) { result.insert(element); });
+
+    return result;
+}
+
+auto Set::difference(const std::span<const Set *const> sets) -> Set {
+    Set result;
+    if (sets.empty()) return result;
+
+    sets.front()->traverse([&sets, &result](const std::string_view element) {
+        if (std::ranges::none_of(sets.subspan(1), [element](const Set *const set) { return set->contains(element); }))
+            result.insert(element);
+    });
+
+    return result;
+}
+
+auto Set::size() const noexcept -> unsigned long {
+    if (const auto intset{std::get_if<Intset>(&this->value)}; intset != nullptr) return intset->size();
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) return listpack->size();
+
+    return std::get<Table>(this->value).size();
+}
+
+auto Set::getMemory() const noexcept -> unsigned long {
+    if (const auto intset{std::get_if<Intset>(&this->value)}; intset != nullptr) return intset->getMemory();
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) return listpack->getMemory();
+
+    return this->tableBytes + std::get<Table>(this->value).getMemory();
+}
+
+auto Set::contains(const std::string_view element) const noexcept -> bool {
+    if (const auto intset{std::get_if<Intset>(&this->value)}; intset != nullptr) {
+        const std::optional integer{Entry::parseInteger(element)};
+
+        return integer.has_value() && intset->contains(*integer);
+    }
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr)
+        return listpack->find(element) != listpack->end();
+
+    return std::get<Table>(this->value).find(element) != nullptr;
+}
+
+auto Set::insert(const std::string_view element) -> bool {
+    if (const auto intset{std::get_if<Intset>(&this->value)}; intset != nullptr) {
+        if (const std::optional integer{Entry::parseInteger(element)}; integer.has_value()) {
+            if (intset->contains(*integer)) return false;
+            if (intset->size() < Config::getSetMaxIntsetEntries()) return intset->insert(*integer);
+        }
+
+        this->convert();
+    }
+
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) {
+        if (listpack->find(element) != listpack->end()) return false;
+
+        if (listpack->size() < Config::getSetMaxListpackEntries() &&
+            element.size() <= Config::getSetMaxListpackValue()) {
+            listpack->insert(listpack->end(), element);
+
+            return true;
+        }
+
+        this->convert();
+    }
+
+    if (!std::get<Table>(this->value).emplace(element)) return false;
+    this->tableBytes += element.size();
+
+    return true;
+}
+
+auto Set::erase(const std::string_view element) noexcept -> bool {
+    if (const auto intset{std::get_if<Intset>(&this->value)}; intset != nullptr) {
+        const std::optional integer{Entry::parseInteger(element)};
+
+        return integer.has_value() && intset->erase(*integer);
+    }
+
+    if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr) {
+        if (const auto result{listpack->find(element)}; result != listpack->end()) {
+            listpack->erase(result);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    if (const std::optional result{std::get<Table>(this->value).erase(element)}; result.has_value()) {
+        this->tableBytes -= result->size();
+
+        return true;
+    }
+
+    return false;
+}
+
+auto Set::traverse(const std::function<auto(std::string_view element)->void> &action) const -> void {
+    if (const auto intset{std::get_if<Intset>(&this->value)}; intset != nullptr) {
+        intset->traverse([&action](const long integer) {
+            std::array<char, std::numeric_limits<long>::digits10 + 2> buffer;
+            const auto [end, error]{std::to_chars(buffer.data(), buffer.data() + buffer.size(), integer)};
+            action(std::string_view{buffer.data(), end});
+        });
+    } else if (const auto listpack{std::get_if<Listpack>(&this->value)}; listpack != nullptr)
+        for (const std::string_view element : *listpack) action(element);
+    else
+        std::get<Table>(this->value).traverse(action);
+}
+
+auto Set::scan(const unsigned long cursor, const unsigned long count,
+               const std::function<auto(std::string_view element)->void> &action) const -> unsigned long {
+    if (!std::holds_alternative<Table>(this->value)) {
+        this->traverse(action);
+
+        return 0;
+    }
+
+    return std::get<Table>(this->value).scan(cursor, count, action);
+}
+
+auto Set::isIntsets(const std::span<const Set *const> sets) noexcept -> bool {
+    return std::ranges::all_of(sets, [](const Set *const set) { return std::holds_alternative<Intset>(set->value); });
+}
+
+auto Set::sortBySize(const std::span<const Set *const> sets) -> std::vector<const Set *> {
+    std::vector<const Set *> sortedSets{sets.begin(), sets.end()};
+    std::ranges::sort(sortedSets, {}, [](const Set *const set) { return set->size(); });
+
+    return sortedSets;
+}
+
+auto Set::convert() -> void {
+    if (std::holds_alternative<Intset>(this->value) && this->size() < Config::getSetMaxListpackEntries()) {
+        Listpack listpack;
+        this->traverse([&listpack](const std::string_view element) { listpack.insert(listpack.end(), element); });
+
+        this->value = std::move(listpack);
+
+        return;
+    }
+
+    Table table;
+    this->traverse([this, &table](const std::string_view element) {
+        table.emplace(element);
+        this->tableBytes += element.size();
+    });
+
+    this->value = std::move(table);
+}
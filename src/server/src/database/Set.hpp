@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Dictionary.hpp"
+#include "Intset.hpp"
+#include "Listpack.hpp"
+
+#include <functional>
+#include <string>
+#include <variant>
+
+class Set {
+public:
+    [[nodiscard]] static auto intersect(std::span<const Set *const> sets) -> Set;
+
+    [[nodiscard]] static auto intersectCount(std::span<const Set *const> sets, unsigned long limit) -> unsigned long;
+
+    [[nodiscard]] static auto unite(std::span<const Set *const> sets) -> Set;
+
+    [[nodiscard]] static auto difference(std::span<const Set *const> sets) -> Set;
+
+    [[nodiscard]] auto size() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto contains(std::string_view element) const noexcept -> bool;
+
+    auto insert(std::string_view element) -> bool;
+
+    auto erase(std::string_view element) noexcept -> bool;
+
+    auto traverse(const std::function<auto(std::string_view element)->void> &action) const -> void;
+
+    [[nodiscard]] auto scan(unsigned long cursor, unsigned long count,
+                            const std::function<auto(std::string_view element)->void> &action) const -> unsigned long;
+
+private:
+    using Table = Dictionary<std::string>;
+
+    [[nodiscard]] static auto isIntsets(std::span<const Set *const> sets) noexcept -> bool;
+
+    [[nodiscard]] static auto sortBySize(std::span<const Set *const> sets) -> std::vector<const Set *>;
+
+    auto convert() -> void;
+
+    static constexpr unsigned long intersectBatchSize{64};
+
+    std::variant<Intset, Listpack, Table> value;
+    unsigned long tableBytes{};
+};
@@ -0,0 +1,36 @@
+#include "ShardLock.hpp"
+
+constinit std::atomic<unsigned long> ShardLock::sequence{0};
+
+auto ShardLock::reset() noexcept -> void { getStamp().reset(); }
+
+auto ShardLock::takeSequence() noexcept -> unsigned long {
+    std::optional<unsigned long> &stamp{getStamp()};
+    const unsigned long result{stamp.has_value() ? *stamp : sequence.fetch_add(1, std::memory_order::relaxed)};
+    stamp.reset();
+
+    return result;
+}
+
+auto ShardLock::lock() -> void { this->mutex.lock(); }
+
+auto ShardLock::try_lock() -> bool { return this->mutex.try_lock(); }
+
+auto ShardLock::unlock() noexcept -> void {
+    if (std::optional<unsigned long> &stamp{getStamp()}; !stamp.has_value())
+        stamp = sequence.fetch_add(1, std::memory_order::relaxed);
+
+    this->mutex.unlock();
+}
+
+auto ShardLock::lock_shared() -> void { this->mutex.lock_shared(); }
+
+auto ShardLock::try_lock_shared() -> bool { return this->mutex.try_lock_shared(); }
+
+auto ShardLock::unlock_shared() noexcept -> void { this->mutex.unlock_shared(); }
+
+auto ShardLock::getStamp() noexcept -> std::optional<unsigned long> & {
+    thread_local std::optional<unsigned long> stamp;
+
+    return stamp;
+}
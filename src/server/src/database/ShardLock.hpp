@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <shared_mutex>
+
+class ShardLock {
+public:
+    static auto reset() noexcept -> void;
+
+    [[nodiscard]] static auto takeSequence() noexcept -> unsigned long;
+
+    auto lock() -> void;
+
+    [[nodiscard]] auto try_lock() -> bool;
+
+    auto unlock() noexcept -> void;
+
+    auto lock_shared() -> void;
+
+    [[nodiscard]] auto try_lock_shared() -> bool;
+
+    auto unlock_shared() noexcept -> void;
+
+private:
+    [[nodiscard]] static auto getStamp() noexcept -> std::optional<unsigned long> &;
+
+    static constinit std::atomic<unsigned long> sequence;
+
+    std::shared_mutex mutex;
+};
@@ -1,37 +1,34 @@
 #include "Skiplist.hpp"
 
+#include "Arena.hpp"
+#include "Epoch.hpp"
+
+#include <algorithm>
+#include <bit>
 #include <random>
 #include <utility>
 
-Skiplist::Skiplist(std::span<const std::byte> serialization) {
-    while (!serialization.empty()) {
-        const auto size{*reinterpret_cast<const unsigned long *>(serialization.data())};
-        serialization = serialization.subspan(sizeof(size));
+Skiplist::Skiplist(Arena &arena, std::span<const std::span<const std::byte>> serializedEntries) :
+    arena{&arena}, start{Node::create(arena, {}, Entry{std::string{}}, maxLevel - 1)} {
+    this->bulkLoad(serializedEntries);
 
-        this->insert(std::make_shared<Entry>(serialization.subspan(0, size)));
-        serialization = serialization.subspan(size);
+    const Epoch::Guard guard;
+    for (const auto serializedEntry : serializedEntries) {
+        const std::string_view key{Entry::deserializeKey(serializedEntry)};
+        if (Node *const node{this->find(key)}; node != nullptr) node->getEntry() = Entry{serializedEntry};
+        else this->insert(Node::create(arena, key, Entry{serializedEntry}, randomLevel()));
     }
 }
 
-Skiplist::Skiplist(const Skiplist &other) : start{other.copy()} {}
-
-Skiplist::Skiplist(Skiplist &&other) noexcept : start{std::exchange(other.start, nullptr)} {}
-
-auto Skiplist::operator=(const Skiplist &other) -> Skiplist & {
-    if (this == &other) return *this;
-
-    this->destroy();
-
-    this->start = other.copy();
-
-    return *this;
-}
+Skiplist::Skiplist(Skiplist &&other) noexcept :
+    arena{std::exchange(other.arena, nullptr)}, start{std::exchange(other.start, nullptr)} {}
 
 auto Skiplist::operator=(Skiplist &&other) noexcept -> Skiplist & {
     if (this == &other) return *this;
 
     this->destroy();
 
+    this->arena = std::exchange(other.arena, nullptr);
     this->start = std::exchange(other.start, nullptr);
 
     return *this;
@@ -39,151 +36,239 @@ auto Skiplist::operator=(Skiplist &&other) noexcept -> Skiplist & {
 
 Skiplist::~Skiplist() { this->destroy(); }
 
-auto Skiplist::find(const std::string_view key) const noexcept -> std::shared_ptr<Entry> {
-    Node *node{this->start};
-    while (node != nullptr) {
-        Node *const next{node->next}, *const down{node->down};
+auto Skiplist::find(const std::string_view key) const noexcept -> Node * {
+    const unsigned long prefix{Node::getPrefix(key)};
+    Node *previous{this->start};
+    for (unsigned char level{maxLevel}; level > 0; --level) {
+        Node *node{unmark(previous->getNext()[level - 1].load(std::memory_order::acquire))};
+        while (node != nullptr) {
+            Node *const next{node->getNext()[level - 1].load(std::memory_order::acquire)};
 
-        if (key == node->entry->getKey()) return node->entry;
+            if (isMarked(next)) node = unmark(next);
+            else if (node->compare(prefix, key) < 0) {
+                previous = node;
+                node = next;
+            } else break;
+        }
+
+        if (node != nullptr && node->compare(prefix, key) == 0) {
+            if (isMarked(node->getNext().front().load(std::memory_order::acquire))) return nullptr;
 
-        if (next != nullptr && key >= next->entry->getKey()) node = next;
-        else node = down;
+            return node;
+        }
     }
 
     return nullptr;
 }
 
-auto Skiplist::insert(std::shared_ptr<Entry> &&entry) const -> void {
-    Node *node{this->start};
-    for (unsigned char level{randomLevel()}; node != nullptr && level < node->level; --level) node = node->down;
+auto Skiplist::insert(Node *const node) const -> void {
+    const Epoch::Guard guard;
 
-    const std::string_view key{entry->getKey()};
-    Node *previous{};
-    while (node != nullptr) {
-        while (node->next != nullptr && key >= node->next->entry->getKey()) node = node->next;
+    const std::span nodeNext{node->getNext()};
+    std::array<Node *, maxLevel> previous{}, next{};
+    while (true) {
+        this->search(node->getKey(), previous, next);
+
+        for (unsigned char level{}; level < nodeNext.size(); ++level)
+            nodeNext[level].store(next[level], std::memory_order::relaxed);
+
+        if (Node *expected{next.front()}; previous.front()->getNext().front().compare_exchange_strong(
+                expected, node, std::memory_order::release, std::memory_order::relaxed))
+            break;
+    }
 
-        if (key != node->entry->getKey()) node->next = new Node{node->level, entry, node->next};
-        else node->entry = entry;
+    for (unsigned char level{1}; level < nodeNext.size(); ++level) {
+        while (true) {
+            Node *successor{nodeNext[level].load(std::memory_order::acquire)};
+            if (isMarked(successor)) return;
+            if (successor != next[level] &&
+                !nodeNext[level].compare_exchange_strong(successor, next[level], std::memory_order::release,
+                                                         std::memory_order::relaxed))
+                return;
 
-        if (previous != nullptr) {
-            previous->down = node->next;
-            previous = previous->down;
-        } else previous = node->next;
+            if (Node *expected{next[level]}; previous[level]->getNext()[level].compare_exchange_strong(
+                    expected, node, std::memory_order::release, std::memory_order::relaxed)) {
+                if (isMarked(nodeNext[level].load(std::memory_order::acquire))) {
+                    this->search(node->getKey(), previous, next);
 
-        node = node->down;
+                    return;
+                }
+
+                break;
+            }
+
+            this->search(node->getKey(), previous, next);
+        }
     }
 }
 
-auto Skiplist::erase(const std::string_view key) const noexcept -> bool {
-    bool isSuccess{};
+auto Skiplist::erase(const std::string_view key) const noexcept -> Node * {
+    const Epoch::Guard guard;
 
-    Node *node{this->start};
-    while (node != nullptr) {
-        while (node->next != nullptr && key > node->next->entry->getKey()) node = node->next;
+    std::array<Node *, maxLevel> previous{}, next{};
+    if (!this->search(key, previous, next)) return nullptr;
+
+    Node *const node{next.front()};
+    const std::span nodeNext{node->getNext()};
+    for (auto level{static_cast<unsigned char>(nodeNext.size() - 1)}; level > 0; --level) {
+        Node *nextNode{nodeNext[level].load(std::memory_order::acquire)};
+        while (!isMarked(nextNode) &&
+               !nodeNext[level].compare_exchange_weak(nextNode, mark(nextNode), std::memory_order::acq_rel,
+                                                      std::memory_order::acquire)) {}
+    }
 
-        Node *const down{node->down};
-        if (const Node *const next{node->next}; next != nullptr && key == next->entry->getKey()) {
-            const Node *const deleteNode{next};
-            node->next = next->next;
-            delete deleteNode;
+    Node *nextNode{nodeNext.front().load(std::memory_order::acquire)};
+    while (!isMarked(nextNode)) {
+        if (nodeNext.front().compare_exchange_weak(nextNode, mark(nextNode), std::memory_order::acq_rel,
+                                                   std::memory_order::acquire)) {
+            this->search(key, previous, next);
 
-            isSuccess = true;
+            return node;
         }
-
-        node = down;
     }
 
-    return isSuccess;
+    return nullptr;
 }
 
-auto Skiplist::serialize() const -> std::vector<std::byte> {
-    const Node *node{this->start};
-    while (node != nullptr && node->down != nullptr) node = node->down;
+auto Skiplist::traverse(const std::function<auto(Node *node)->void> &action) const -> void {
+    const Epoch::Guard guard;
 
-    std::vector<std::byte> serialization{sizeof(unsigned long)};
-    while (node != nullptr) {
-        const std::vector serializedEntry{node->entry->serialize()};
-        serialization.insert(serialization.cend(), serializedEntry.cbegin(), serializedEntry.cend());
+    for (Node *node{unmark(this->start->getNext().front().load(std::memory_order::acquire))}; node != nullptr;) {
+        Node *const next{node->getNext().front().load(std::memory_order::acquire)};
 
-        node = node->next;
-    }
-    *reinterpret_cast<unsigned long *>(serialization.data()) = serialization.size() - sizeof(unsigned long);
-
-    return serialization;
-}
-
-auto Skiplist::initlialize() -> Node * {
-    Node *start{}, *previous{};
-    const auto entry{std::make_shared<Entry>(std::string{}, std::string{})};
-    for (unsigned char i{maxLevel}; i > 0; --i) {
-        const auto node{
-            new Node{static_cast<decltype(i)>(i - 1), entry}
-        };
-        if (previous != nullptr) {
-            previous->down = node;
-            previous = previous->down;
-        } else start = previous = node;
+        if (!isMarked(next)) action(node);
+
+        node = unmark(next);
     }
+}
+
+auto Skiplist::traverse(const std::string_view key, const std::function<auto(Node *node)->bool> &action) const
+    -> void {
+    const Epoch::Guard guard;
 
-    return start;
+    for (Node *node{this->lowerBound(key)}; node != nullptr && action(node); node = getNext(node));
 }
 
-auto Skiplist::random() -> double {
-    static std::mt19937 generator{std::random_device{}()};
-    static std::uniform_real_distribution<> distribution{0, 1};
+auto Skiplist::lowerBound(const std::string_view key) const noexcept -> Node * {
+    const unsigned long prefix{Node::getPrefix(key)};
+    Node *previous{this->start}, *node{};
+    for (unsigned char level{maxLevel}; level > 0; --level) {
+        node = unmark(previous->getNext()[level - 1].load(std::memory_order::acquire));
+        while (node != nullptr) {
+            Node *const next{node->getNext()[level - 1].load(std::memory_order::acquire)};
 
-    return distribution(generator);
+            if (isMarked(next)) node = unmark(next);
+            else if (node->compare(prefix, key) < 0) {
+                previous = node;
+                node = next;
+            } else break;
+        }
+    }
+
+    return skipMarked(node);
+}
+
+auto Skiplist::getNext(Node *const node) noexcept -> Node * {
+    return skipMarked(unmark(node->getNext().front().load(std::memory_order::acquire)));
 }
 
 auto Skiplist::randomLevel() -> unsigned char {
     unsigned char level{};
-    while (random() < 0.5 && level < maxLevel) ++level;
+    while (random() < 0.5 && level < maxLevel - 1) ++level;
 
     return level;
 }
 
-auto Skiplist::copy() const -> Node * {
-    const Node *node{this->start};
+auto Skiplist::random() -> double {
+    thread_local std::mt19937 generator{std::random_device{}()};
+    thread_local std::uniform_real_distribution<> distribution{0, 1};
+
+    return distribution(generator);
+}
 
-    Node *newStart{}, *newPrevious{};
+auto Skiplist::skipMarked(Node *node) noexcept -> Node * {
     while (node != nullptr) {
-        const Node *const down{node->down};
+        Node *const next{node->getNext().front().load(std::memory_order::acquire)};
+        if (!isMarked(next)) break;
 
-        Node *subNewNode{}, *subNewPrevious{};
-        while (node != nullptr) {
-            const auto newNode{
-                new Node{node->level, std::make_shared<Entry>(*node->entry)}
-            };
+        node = unmark(next);
+    }
 
-            if (subNewPrevious != nullptr) {
-                subNewPrevious->next = newNode;
-                subNewPrevious = subNewPrevious->next;
-            } else subNewNode = subNewPrevious = newNode;
+    return node;
+}
 
-            node = node->next;
-        }
+auto Skiplist::isMarked(const Node *const node) noexcept -> bool { return reinterpret_cast<std::uintptr_t>(node) & 1; }
+
+auto Skiplist::mark(const Node *const node) noexcept -> Node * {
+    return reinterpret_cast<Node *>(reinterpret_cast<std::uintptr_t>(node) | 1);
+}
 
-        if (newPrevious != nullptr) {
-            newPrevious->down = subNewNode;
-            newPrevious = newPrevious->down;
-        } else newStart = newPrevious = subNewNode;
+auto Skiplist::unmark(const Node *const node) noexcept -> Node * {
+    return reinterpret_cast<Node *>(reinterpret_cast<std::uintptr_t>(node) & ~std::uintptr_t{1});
+}
 
-        node = down;
+auto Skiplist::search(const std::string_view key, const std::span<Node *, maxLevel> previous,
+                      const std::span<Node *, maxLevel> next) const noexcept -> bool {
+    const unsigned long prefix{Node::getPrefix(key)};
+    bool isRetry{true};
+    while (isRetry) {
+        isRetry = false;
+
+        Node *previousNode{this->start};
+        for (unsigned char level{maxLevel}; level > 0 && !isRetry; --level) {
+            Node *node{unmark(previousNode->getNext()[level - 1].load(std::memory_order::acquire))};
+            while (node != nullptr) {
+                Node *const nextNode{node->getNext()[level - 1].load(std::memory_order::acquire)};
+
+                if (isMarked(nextNode)) {
+                    if (Node *expected{node}; !previousNode->getNext()[level - 1].compare_exchange_strong(
+                            expected, unmark(nextNode), std::memory_order::acq_rel, std::memory_order::relaxed)) {
+                        isRetry = true;
+
+                        break;
+                    }
+
+                    node = unmark(nextNode);
+                } else if (node->compare(prefix, key) < 0) {
+                    previousNode = node;
+                    node = nextNode;
+                } else break;
+            }
+
+            previous[level - 1] = previousNode;
+            next[level - 1] = node;
+        }
     }
 
-    return newStart;
+    return next.front() != nullptr && next.front()->compare(prefix, key) == 0;
+}
+
+auto Skiplist::bulkLoad(std::span<const std::span<const std::byte>> &serializedEntries) -> void {
+    std::array<Node *, maxLevel> tails;
+    tails.fill(this->start);
+
+    for (unsigned long count{1}; !serializedEntries.empty(); ++count) {
+        const std::span serializedEntry{serializedEntries.front()};
+        const std::string_view key{Entry::deserializeKey(serializedEntry)};
+        if (tails.front() != this->start && tails.front()->compare(Node::getPrefix(key), key) >= 0) return;
+
+        const auto level{static_cast<unsigned char>(std::min(std::countr_zero(count), maxLevel - 1))};
+        Node *const node{Node::create(*this->arena, key, Entry{serializedEntry}, level)};
+        for (unsigned char i{}; i <= level; ++i) {
+            tails[i]->getNext()[i].store(node, std::memory_order::relaxed);
+            tails[i] = node;
+        }
+
+        serializedEntries = serializedEntries.subspan(1);
+    }
 }
 
 auto Skiplist::destroy() noexcept -> void {
-    const Node *node{this->start};
+    Node *node{this->start};
     while (node != nullptr) {
-        const Node *const down{node->down};
-        while (node != nullptr) {
-            const Node *const next{node->next};
-            delete node;
-            node = next;
-        }
-        node = down;
+        Node *const next{unmark(node->getNext().front().load(std::memory_order::relaxed))};
+        Node::destroy(*this->arena, node);
+        node = next;
     }
 
     this->start = nullptr;
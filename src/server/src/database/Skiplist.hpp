@@ -1,51 +1,63 @@
 #pragma once
 
-#include "Entry.hpp"
+#include "Node.hpp"
 
-#include <memory>
+#include <functional>
 
 class Skiplist {
-    struct Node {
-        unsigned char level;
-        std::shared_ptr<Entry> entry;
-        Node *next{}, *down{};
-    };
-
 public:
     Skiplist() = default;
 
-    explicit Skiplist(std::span<const std::byte> serialization);
+    Skiplist(Arena &arena, std::span<const std::span<const std::byte>> serializedEntries);
 
-    Skiplist(const Skiplist &);
+    Skiplist(const Skiplist &) = delete;
 
     Skiplist(Skiplist &&) noexcept;
 
-    auto operator=(const Skiplist &) -> Skiplist &;
+    auto operator=(const Skiplist &) -> Skiplist & = delete;
 
     auto operator=(Skiplist &&) noexcept -> Skiplist &;
 
     ~Skiplist();
 
-    [[nodiscard]] auto find(std::string_view key) const noexcept -> std::shared_ptr<Entry>;
+    // the caller must hold an Epoch::Guard for as long as it uses the returned node
+    [[nodiscard]] auto find(std::string_view key) const noexcept -> Node *;
+
+    auto insert(Node *node) const -> void;
+
+    [[nodiscard]] auto erase(std::string_view key) const noexcept -> Node *;
+
+    auto traverse(const std::function<auto(Node *node)->void> &action) const -> void;
 
-    auto insert(std::shared_ptr<Entry> &&entry) const -> void;
+    auto traverse(std::string_view key, const std::function<auto(Node *node)->bool> &action) const -> void;
 
-    auto erase(std::string_view key) const noexcept -> bool;
+    // the caller must hold an Epoch::Guard for as long as it uses the returned nodes
+    [[nodiscard]] auto lowerBound(std::string_view key) const noexcept -> Node *;
 
-    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+    [[nodiscard]] static auto getNext(Node *node) noexcept -> Node *;
+
+    [[nodiscard]] static auto randomLevel() -> unsigned char;
 
 private:
-    [[nodiscard]] static auto initlialize() -> Node *;
+    static constexpr unsigned char maxLevel{32};
 
     [[nodiscard]] static auto random() -> double;
 
-    [[nodiscard]] static auto randomLevel() -> unsigned char;
+    [[nodiscard]] static auto skipMarked(Node *node) noexcept -> Node *;
 
-    [[nodiscard]] auto copy() const -> Node *;
+    [[nodiscard]] static auto isMarked(const Node *node) noexcept -> bool;
 
-    auto destroy() noexcept -> void;
+    [[nodiscard]] static auto mark(const Node *node) noexcept -> Node *;
 
-    static constexpr unsigned char maxLevel{32};
+    [[nodiscard]] static auto unmark(const Node *node) noexcept -> Node *;
+
+    auto search(std::string_view key, std::span<Node *, maxLevel> previous, std::span<Node *, maxLevel> next) const
+        noexcept -> bool;
+
+    auto bulkLoad(std::span<const std::span<const std::byte>> &serializedEntries) -> void;
+
+    auto destroy() noexcept -> void;
 
-    Node *start{initlialize()};
+    Arena *arena{};
+    Node *start{};
 };
@@ -0,0 +1,279 @@
+#include "SortedSet.hpp"
+
+#include "Skiplist.hpp"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <utility>
+
+auto SortedSet::parseScore(std::string_view text) noexcept -> std::optional<double> {
+    if (text.starts_with('+') && !text.substr(1).starts_with('-')) text.remove_prefix(1);
+
+    double score;
+    if (const auto [end, error]{std::from_chars(text.data(), text.data() + text.size(), score)};
+        error != std::errc{} || end != text.data() + text.size() || isNan(score))
+        return std::nullopt;
+
+    return score;
+}
+
+auto SortedSet::parseBound(std::string_view text) noexcept -> std::optional<Bound> {
+    const bool isExclusive{text.starts_with('(')};
+    if (isExclusive) text.remove_prefix(1);
+
+    if (const std::optional score{parseScore(text)}; score.has_value()) return Bound{*score, isExclusive};
+
+    return std::nullopt;
+}
+
+auto SortedSet::formatScore(const double score) -> std::string {
+    std::array<char, 32> buffer;
+    const auto [end, error]{std::to_chars(buffer.data(), buffer.data() + buffer.size(), score)};
+
+    return {buffer.data(), end};
+}
+
+// release builds use -Ofast, under which std::isnan may fold to false
+auto SortedSet::isNan(const double score) noexcept -> bool {
+    constexpr unsigned long exponent{0x7ff0000000000000}, mantissa{0x000fffffffffffff};
+    const auto bits{std::bit_cast<unsigned long>(score)};
+
+    return (bits & exponent) == exponent && (bits & mantissa) != 0;
+}
+
+SortedSet::SortedSet() : head{new Node{{}, {}, std::vector<Node::Level>(maxLevel)}} {}
+
+SortedSet::SortedSet(SortedSet &&other) noexcept :
+    head{std::exchange(other.head, nullptr)}, level{std::exchange(other.level, 1)},
+    length{std::exchange(other.length, 0)}, bytes{std::exchange(other.bytes, 0)}, members{std::move(other.members)} {}
+
+auto SortedSet::operator=(SortedSet &&other) noexcept -> SortedSet & {
+    if (this == &other) return *this;
+
+    this->destroy();
+
+    this->head = std::exchange(other.head, nullptr);
+    this->level = std::exchange(other.level, 1);
+    this->length = std::exchange(other.length, 0);
+    this->bytes = std::exchange(other.bytes, 0);
+    this->members = std::move(other.members);
+
+    return *this;
+}
+
+SortedSet::~SortedSet() { this->destroy(); }
+
+auto SortedSet::size() const noexcept -> unsigned long { return this->length; }
+
+auto SortedSet::getMemory() const noexcept -> unsigned long {
+    return this->bytes + this->length * nodeMemory + this->members.bucket_count() * sizeof(void *) +
+           maxLevel * sizeof(Node::Level);
+}
+
+auto SortedSet::score(const std::string_view member) const noexcept -> std::optional<double> {
+    if (const auto result{this->members.find(member)}; result != this->members.cend()) return result->second->score;
+
+    return std::nullopt;
+}
+
+auto SortedSet::rank(const std::string_view member) const noexcept -> std::optional<unsigned long> {
+    const auto result{this->members.find(member)};
+    if (result == this->members.cend()) return std::nullopt;
+
+    const Node *const target{result->second};
+    const Node *node{this->head};
+    unsigned long rank{};
+    for (unsigned char i{this->level}; i-- > 0;) {
+        while (node->levels[i].next != nullptr && node->levels[i].next != target &&
+               isLess(node->levels[i].next, target->score, target->member)) {
+            rank += node->levels[i].span;
+            node = node->levels[i].next;
+        }
+
+        if (node->levels[i].next == target) return rank + node->levels[i].span - 1;
+    }
+
+    return std::nullopt;
+}
+
+auto SortedSet::count(const Bound min, const Bound max) const noexcept -> unsigned long {
+    const unsigned long below{this->countBelow(min)}, notAbove{this->countNotAbove(max)};
+
+    return notAbove > below ? notAbove - below : 0;
+}
+
+auto SortedSet::insert(const std::string_view member, const double score) -> bool {
+    if (const auto result{this->members.find(member)}; result != this->members.cend()) {
+        Node *const node{result->second};
+        if (node->score == score) return false;
+
+        this->unlink(node);
+        node->score = score;
+        this->link(node);
+
+        return false;
+    }
+
+    auto *const node{new Node{std::string{member}, score, std::vector<Node::Level>(Skiplist::randomLevel() + 1)}};
+    this->link(node);
+    this->members.emplace(node->member, node);
+    this->bytes += member.size() + node->levels.size() * sizeof(Node::Level);
+
+    return true;
+}
+
+auto SortedSet::erase(const std::string_view member) noexcept -> bool {
+    const auto result{this->members.find(member)};
+    if (result == this->members.cend()) return false;
+
+    const Node *const node{result->second};
+    this->members.erase(result);
+    this->unlink(node);
+    this->bytes -= node->member.size() + node->levels.size() * sizeof(Node::Level);
+    delete node;
+
+    return true;
+}
+
+auto SortedSet::range(const unsigned long start, const unsigned long end,
+                      const std::function<auto(std::string_view member, double score)->void> &action) const -> void {
+    const Node *node{this->getByRank(start + 1)};
+    for (unsigned long i{start}; i <= end && node != nullptr; ++i) {
+        action(node->member, node->score);
+        node = node->levels.front().next;
+    }
+}
+
+auto SortedSet::rangeByScore(const Bound min, const Bound max,
+                             const std::function<auto(std::string_view member, double score)->void> &action) const
+    -> void {
+    const Node *node{this->head};
+    for (unsigned char i{this->level}; i-- > 0;)
+        while (node->levels[i].next != nullptr && !isAboveMin(node->levels[i].next->score, min))
+            node = node->levels[i].next;
+
+    for (node = node->levels.front().next; node != nullptr && isBelowMax(node->score, max);
+         node = node->levels.front().next)
+        action(node->member, node->score);
+}
+
+auto SortedSet::traverse(const std::function<auto(std::string_view member, double score)->void> &action) const
+    -> void {
+    for (const Node *node{this->head->levels.front().next}; node != nullptr; node = node->levels.front().next)
+        action(node->member, node->score);
+}
+
+auto SortedSet::isLess(const Node *const node, const double score, const std::string_view member) noexcept -> bool {
+    return node->score < score || (node->score == score && node->member < member);
+}
+
+auto SortedSet::isAboveMin(const double score, const Bound min) noexcept -> bool {
+    return min.isExclusive ? score > min.score : score >= min.score;
+}
+
+auto SortedSet::isBelowMax(const double score, const Bound max) noexcept -> bool {
+    return max.isExclusive ? score < max.score : score <= max.score;
+}
+
+auto SortedSet::countBelow(const Bound min) const noexcept -> unsigned long {
+    const Node *node{this->head};
+    unsigned long count{};
+    for (unsigned char i{this->level}; i-- > 0;)
+        while (node->levels[i].next != nullptr && !isAboveMin(node->levels[i].next->score, min)) {
+            count += node->levels[i].span;
+            node = node->levels[i].next;
+        }
+
+    return count;
+}
+
+auto SortedSet::countNotAbove(const Bound max) const noexcept -> unsigned long {
+    const Node *node{this->head};
+    unsigned long count{};
+    for (unsigned char i{this->level}; i-- > 0;)
+        while (node->levels[i].next != nullptr && isBelowMax(node->levels[i].next->score, max)) {
+            count += node->levels[i].span;
+            node = node->levels[i].next;
+        }
+
+    return count;
+}
+
+auto SortedSet::getByRank(const unsigned long rank) const noexcept -> Node * {
+    Node *node{this->head};
+    unsigned long traversed{};
+    for (unsigned char i{this->level}; i-- > 0;) {
+        while (node->levels[i].next != nullptr && traversed + node->levels[i].span <= rank) {
+            traversed += node->levels[i].span;
+            node = node->levels[i].next;
+        }
+
+        if (traversed == rank) return node == this->head ? nullptr : node;
+    }
+
+    return nullptr;
+}
+
+auto SortedSet::link(Node *const node) noexcept -> void {
+    std::array<Node *, maxLevel> previous;
+    std::array<unsigned long, maxLevel> ranks;
+
+    Node *current{this->head};
+    for (unsigned char i{this->level}; i-- > 0;) {
+        ranks[i] = i + 1 == this->level ? 0 : ranks[i + 1];
+        while (current->levels[i].next != nullptr && isLess(current->levels[i].next, node->score, node->member)) {
+            ranks[i] += current->levels[i].span;
+            current = current->levels[i].next;
+        }
+        previous[i] = current;
+    }
+
+    const auto nodeLevel{static_cast<unsigned char>(node->levels.size())};
+    for (; this->level < nodeLevel; ++this->level) {
+        ranks[this->level] = 0;
+        previous[this->level] = this->head;
+        this->head->levels[this->level].span = this->length;
+    }
+
+    for (unsigned char i{}; i < nodeLevel; ++i) {
+        node->levels[i].next = previous[i]->levels[i].next;
+        previous[i]->levels[i].next = node;
+
+        node->levels[i].span = previous[i]->levels[i].span - (ranks.front() - ranks[i]);
+        previous[i]->levels[i].span = ranks.front() - ranks[i] + 1;
+    }
+    for (unsigned char i{nodeLevel}; i < this->level; ++i) ++previous[i]->levels[i].span;
+
+    ++this->length;
+}
+
+auto SortedSet::unlink(const Node *const node) noexcept -> void {
+    Node *current{this->head};
+    for (unsigned char i{this->level}; i-- > 0;) {
+        while (current->levels[i].next != nullptr && current->levels[i].next != node &&
+               isLess(current->levels[i].next, node->score, node->member))
+            current = current->levels[i].next;
+
+        if (current->levels[i].next == node) {
+            current->levels[i].span += node->levels[i].span - 1;
+            current->levels[i].next = node->levels[i].next;
+        } else --current->levels[i].span;
+    }
+
+    while (this->level > 1 && this->head->levels[this->level - 1].next == nullptr) --this->level;
+    --this->length;
+}
+
+auto SortedSet::destroy() noexcept -> void {
+    if (this->head == nullptr) return;
+
+    for (const Node *node{this->head}; node != nullptr;) {
+        const Node *const next{node->levels.front().next};
+        delete node;
+        node = next;
+    }
+
+    this->head = nullptr;
+    this->members.clear();
+}
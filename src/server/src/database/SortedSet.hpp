@@ -0,0 +1,96 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class SortedSet {
+    struct Node {
+        struct Level {
+            Node *next;
+            unsigned long span;
+        };
+
+        std::string member;
+        double score;
+        std::vector<Level> levels;
+    };
+
+public:
+    struct Bound {
+        double score;
+        bool isExclusive;
+    };
+
+    [[nodiscard]] static auto parseScore(std::string_view text) noexcept -> std::optional<double>;
+
+    [[nodiscard]] static auto parseBound(std::string_view text) noexcept -> std::optional<Bound>;
+
+    [[nodiscard]] static auto formatScore(double score) -> std::string;
+
+    [[nodiscard]] static auto isNan(double score) noexcept -> bool;
+
+    SortedSet();
+
+    SortedSet(const SortedSet &) = delete;
+
+    SortedSet(SortedSet &&) noexcept;
+
+    auto operator=(const SortedSet &) -> SortedSet & = delete;
+
+    auto operator=(SortedSet &&) noexcept -> SortedSet &;
+
+    ~SortedSet();
+
+    [[nodiscard]] auto size() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto score(std::string_view member) const noexcept -> std::optional<double>;
+
+    [[nodiscard]] auto rank(std::string_view member) const noexcept -> std::optional<unsigned long>;
+
+    [[nodiscard]] auto count(Bound min, Bound max) const noexcept -> unsigned long;
+
+    auto insert(std::string_view member, double score) -> bool;
+
+    auto erase(std::string_view member) noexcept -> bool;
+
+    auto range(unsigned long start, unsigned long end,
+               const std::function<auto(std::string_view member, double score)->void> &action) const -> void;
+
+    auto rangeByScore(Bound min, Bound max,
+                      const std::function<auto(std::string_view member, double score)->void> &action) const -> void;
+
+    auto traverse(const std::function<auto(std::string_view member, double score)->void> &action) const -> void;
+
+private:
+    static constexpr unsigned char maxLevel{32};
+    static constexpr unsigned long nodeMemory{sizeof(Node) + sizeof(std::pair<const std::string_view, Node *>) +
+                                              sizeof(void *) * 2};
+
+    [[nodiscard]] static auto isLess(const Node *node, double score, std::string_view member) noexcept -> bool;
+
+    [[nodiscard]] static auto isAboveMin(double score, Bound min) noexcept -> bool;
+
+    [[nodiscard]] static auto isBelowMax(double score, Bound max) noexcept -> bool;
+
+    [[nodiscard]] auto countBelow(Bound min) const noexcept -> unsigned long;
+
+    [[nodiscard]] auto countNotAbove(Bound max) const noexcept -> unsigned long;
+
+    [[nodiscard]] auto getByRank(unsigned long rank) const noexcept -> Node *;
+
+    auto link(Node *node) noexcept -> void;
+
+    auto unlink(const Node *node) noexcept -> void;
+
+    auto destroy() noexcept -> void;
+
+    Node *head;
+    unsigned char level{1};
+    unsigned long length{}, bytes{};
+    std::unordered_map<std::string_view, Node *> members;
+};
@@ -0,0 +1,38 @@
+#include "StringHash.hpp"
+
+#include <cstring>
+#include <functional>
+
+auto StringHash::murmur(const std::string_view string, const unsigned long seed) noexcept -> unsigned long {
+    constexpr unsigned long multiplier{0xc6a4a7935bd1e995};
+    constexpr unsigned char shift{47};
+
+    unsigned long result{seed ^ string.size() * multiplier}, i{};
+    for (; i + sizeof(unsigned long) <= string.size(); i += sizeof(unsigned long)) {
+        unsigned long block;
+        std::memcpy(&block, string.data() + i, sizeof(block));
+
+        block *= multiplier;
+        block ^= block >> shift;
+        block *= multiplier;
+
+        result ^= block;
+        result *= multiplier;
+    }
+
+    if (const unsigned long rest{string.size() - i}; rest != 0) {
+        for (unsigned long j{}; j < rest; ++j)
+            result ^= static_cast<unsigned long>(static_cast<unsigned char>(string[i + j])) << j * 8;
+        result *= multiplier;
+    }
+
+    result ^= result >> shift;
+    result *= multiplier;
+    result ^= result >> shift;
+
+    return result;
+}
+
+auto StringHash::operator()(const std::string_view string) const noexcept -> unsigned long {
+    return std::hash<std::string_view>{}(string);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string_view>
+
+struct StringHash {
+    using is_transparent = void;
+
+    [[nodiscard]] static auto murmur(std::string_view string, unsigned long seed) noexcept -> unsigned long;
+
+    [[nodiscard]] auto operator()(std::string_view string) const noexcept -> unsigned long;
+};
@@ -0,0 +1,166 @@
+#include "TopK.hpp"
+
+#include "RowHash.hpp"
+#include "StringHash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+TopK::TopK(const unsigned int k, const unsigned int width, const unsigned int depth, const double decay) :
+    buckets(static_cast<unsigned long>(width) * depth), k{k}, width{width}, depth{depth}, decay{decay} {
+    this->heap.reserve(k);
+}
+
+TopK::TopK(std::span<const std::byte> serialization) {
+    const auto read{[&serialization]<typename T>(T &value) {
+        std::memcpy(&value, serialization.data(), sizeof(value));
+        serialization = serialization.subspan(sizeof(value));
+    }};
+
+    unsigned long size;
+    read(this->k);
+    read(this->width);
+    read(this->depth);
+    read(this->decay);
+    read(size);
+
+    this->buckets.resize(static_cast<unsigned long>(this->width) * this->depth);
+    std::ranges::copy(serialization.first(this->buckets.size() * sizeof(Bucket)),
+                      std::as_writable_bytes(std::span{this->buckets}).begin());
+    serialization = serialization.subspan(this->buckets.size() * sizeof(Bucket));
+
+    this->heap.reserve(this->k);
+    for (unsigned long i{}; i < size; ++i) {
+        Item item;
+        unsigned long length;
+        read(item.fingerprint);
+        read(item.count);
+        read(length);
+
+        item.element = std::string{reinterpret_cast<const char *>(serialization.data()), length};
+        serialization = serialization.subspan(length);
+
+        this->heap.emplace_back(std::move(item));
+    }
+}
+
+auto TopK::isCreatable(const unsigned long k, const unsigned long width, const unsigned long depth) noexcept -> bool {
+    return k > 0 && k <= maxK && RowHash::isCreatable(width, depth, sizeof(Bucket));
+}
+
+auto TopK::getMemory() const noexcept -> unsigned long {
+    unsigned long memory{this->buckets.capacity() * sizeof(Bucket) + this->heap.capacity() * sizeof(Item)};
+    for (const auto &item : this->heap) memory += item.element.capacity();
+
+    return memory;
+}
+
+auto TopK::add(const std::string_view element) -> std::optional<std::string> {
+    const unsigned long hash{StringHash::murmur(element, hashSeed)};
+    const auto fingerprint{static_cast<unsigned int>(hash * 0x9e3779b97f4a7c15 >> 32)};
+
+    std::vector<unsigned int> offsets(this->depth);
+    RowHash::hash(hash, this->width, offsets);
+
+    unsigned int count{};
+    for (const unsigned int offset : offsets) {
+        Bucket &bucket{this->buckets[offset]};
+
+        if (bucket.count == 0) bucket = {fingerprint, 1};
+        else if (bucket.fingerprint == fingerprint) ++bucket.count;
+        else if (random() < std::pow(this->decay, bucket.count) && --bucket.count == 0) bucket = {fingerprint, 1};
+        else continue;
+
+        count = std::max(count, bucket.count);
+    }
+
+    if (const auto result{std::ranges::find_if(this->heap,
+                                               [fingerprint, element](const Item &item) {
+                                                   return item.fingerprint == fingerprint && item.element == element;
+                                               })};
+        result != this->heap.end()) {
+        if (count > result->count) {
+            result->count = count;
+            this->siftDown(static_cast<unsigned long>(result - this->heap.begin()));
+        }
+
+        return std::nullopt;
+    }
+
+    if (this->heap.size() < this->k) {
+        this->heap.emplace_back(Item{std::string{element}, fingerprint, count});
+        std::ranges::push_heap(this->heap, isHeavier);
+
+        return std::nullopt;
+    }
+
+    if (count <= this->heap.front().count) return std::nullopt;
+
+    std::string expelled{std::move(this->heap.front().element)};
+    this->heap.front() = Item{std::string{element}, fingerprint, count};
+    this->siftDown(0);
+
+    return expelled;
+}
+
+auto TopK::list() const -> std::vector<std::pair<std::string, unsigned int>> {
+    std::vector<std::pair<std::string, unsigned int>> items;
+    items.reserve(this->heap.size());
+    for (const auto &item : this->heap) items.emplace_back(item.element, item.count);
+
+    std::ranges::sort(items, std::ranges::greater{}, &std::pair<std::string, unsigned int>::second);
+
+    return items;
+}
+
+auto TopK::serialize() const -> std::vector<std::byte> {
+    std::vector<std::byte> serialization;
+    const auto write{[&serialization](const auto &value) {
+        const auto bytes{std::as_bytes(std::span{&value, 1})};
+        serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+    }};
+
+    write(this->k);
+    write(this->width);
+    write(this->depth);
+    write(this->decay);
+    write(this->heap.size());
+
+    const auto bytes{std::as_bytes(std::span{this->buckets})};
+    serialization.insert(serialization.cend(), bytes.begin(), bytes.end());
+
+    for (const auto &item : this->heap) {
+        write(item.fingerprint);
+        write(item.count);
+        write(item.element.size());
+
+        const auto elementBytes{std::as_bytes(std::span{item.element})};
+        serialization.insert(serialization.cend(), elementBytes.begin(), elementBytes.end());
+    }
+
+    return serialization;
+}
+
+auto TopK::random() -> double {
+    thread_local std::minstd_rand generator{std::random_device{}()};
+    thread_local std::uniform_real_distribution distribution{0.0, 1.0};
+
+    return distribution(generator);
+}
+
+auto TopK::isHeavier(const Item &left, const Item &right) noexcept -> bool { return left.count > right.count; }
+
+auto TopK::siftDown(unsigned long index) noexcept -> void {
+    while (true) {
+        unsigned long smallest{index};
+        for (const unsigned long child : {2 * index + 1, 2 * index + 2})
+            if (child < this->heap.size() && this->heap[child].count < this->heap[smallest].count) smallest = child;
+
+        if (smallest == index) return;
+
+        std::swap(this->heap[index], this->heap[smallest]);
+        index = smallest;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+class TopK {
+public:
+    static constexpr unsigned long defaultWidth{8}, defaultDepth{7};
+    static constexpr double defaultDecay{0.9};
+
+    TopK(unsigned int k, unsigned int width, unsigned int depth, double decay);
+
+    explicit TopK(std::span<const std::byte> serialization);
+
+    [[nodiscard]] static auto isCreatable(unsigned long k, unsigned long width, unsigned long depth) noexcept -> bool;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] auto add(std::string_view element) -> std::optional<std::string>;
+
+    [[nodiscard]] auto list() const -> std::vector<std::pair<std::string, unsigned int>>;
+
+    [[nodiscard]] auto serialize() const -> std::vector<std::byte>;
+
+private:
+    struct Bucket {
+        unsigned int fingerprint, count;
+    };
+
+    struct Item {
+        std::string element;
+        unsigned int fingerprint, count;
+    };
+
+    static constexpr unsigned long hashSeed{0x1b873593}, maxK{1UL << 16};
+
+    [[nodiscard]] static auto random() -> double;
+
+    [[nodiscard]] static auto isHeavier(const Item &left, const Item &right) noexcept -> bool;
+
+    auto siftDown(unsigned long index) noexcept -> void;
+
+    std::vector<Bucket> buckets;
+    std::vector<Item> heap;
+    unsigned int k, width, depth;
+    double decay;
+};
@@ -1,17 +1,23 @@
 #include "DatabaseManager.hpp"
 
-#include "../../../common/command/Command.hpp"
+#include "../../../common/frame/Frame.hpp"
 #include "../../../common/log/Exception.hpp"
+#include "../config/Config.hpp"
+#include "../database/Epoch.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
 #include <linux/io_uring.h>
 #include <ranges>
+#include <utility>
 
 static constexpr std::string filepath{"dump.aof"};
 
+constinit std::atomic<unsigned long> DatabaseManager::instanceCount{0};
+
 auto DatabaseManager::create(const std::source_location sourceLocation) -> int {
     const int fileDescriptor{open(filepath.data(), O_CREAT | O_WRONLY | O_APPEND | O_SYNC, S_IRUSR | S_IWUSR)};
     if (fileDescriptor == -1) {
@@ -31,8 +37,28 @@ auto DatabaseManager::create(const std::source_location sourceLocation) -> int {
     return fileDescriptor;
 }
 
-DatabaseManager::DatabaseManager(const int fileDescriptor) : FileDescriptor{fileDescriptor} {
+auto DatabaseManager::getKey(std::span<const std::byte> request) noexcept -> std::string_view {
+    if (request.size() < sizeof(Command) + sizeof(unsigned long)) return {};
+
+    if (std::to_underlying(request.front()) >= commandCount) return {};
+
+    const CommandSpecification &specification{getSpecification(static_cast<Command>(request.front()))};
+    if (!specification.isSingleKey()) return {};
+
+    request = request.subspan(sizeof(Command) + sizeof(unsigned long));
+    for (unsigned char i{1}; i < specification.firstKey; ++i)
+        if (!Frame::decode(request).has_value()) return {};
+
+    const std::optional key{Frame::decode(request)};
+    if (!key.has_value()) return {};
+
+    return {reinterpret_cast<const char *>(key->data()), key->size()};
+}
+
+DatabaseManager::DatabaseManager(const int fileDescriptor) :
+    FileDescriptor{fileDescriptor}, instance{instanceCount.fetch_add(1, std::memory_order::relaxed)} {
     for (unsigned char i{}; i < 16; ++i) this->databases.emplace(i, Database{i, std::span<const std::byte>{}});
+    this->publish();
 
     if (std::ifstream file{filepath}; file.is_open()) {
         std::vector<std::byte> buffer{std::filesystem::file_size(filepath)};
@@ -57,6 +83,7 @@ DatabaseManager::DatabaseManager(const int fileDescriptor) : FileDescriptor{file
 
             --count;
         }
+        this->publish();
 
         while (!data.empty()) {
             const auto size{*reinterpret_cast<const unsigned long *>(data.data())};
@@ -68,415 +95,456 @@ DatabaseManager::DatabaseManager(const int fileDescriptor) : FileDescriptor{file
     }
 }
 
-auto DatabaseManager::query(std::span<const std::byte> request) -> std::vector<std::byte> {
-    const std::span requestCopy{request};
-
-    const auto command{static_cast<Command>(request.front())};
-    request = request.subspan(sizeof(command));
-
-    const auto index{*reinterpret_cast<const unsigned long *>(request.data())};
-    request = request.subspan(sizeof(index));
-
-    const std::string_view statement{reinterpret_cast<const char *>(request.data()), request.size()};
-
-    std::string response;
-    bool isRecord{};
-    switch (command) {
-        case Command::select:
-            {
-                const std::lock_guard lockGuard{this->lock};
-
-                this->databases.try_emplace(index, Database{index, std::span<const std::byte>{}});
-                response = "OK";
-                isRecord = true;
-
-                break;
-            }
-        case Command::del:
-            {
-                const std::shared_lock sharedLock{this->lock};
-
-                response = this->databases.at(index).del(statement);
-                isRecord = true;
-
-                break;
-            }
-        case Command::exists:
-            {
-                const std::shared_lock sharedLock{this->lock};
-
-                response = this->databases.at(index).exists(statement);
-
-                break;
-            }
-        case Command::move:
-            {
-                const std::shared_lock sharedLock{this->lock};
-
-                response = this->databases.at(index).move(this->databases, statement);
-                isRecord = true;
+DatabaseManager::~DatabaseManager() { delete this->view.load(std::memory_order::relaxed); }
 
-                break;
-            }
-        case Command::rename:
-            {
-                const std::shared_lock sharedLock{this->lock};
+auto DatabaseManager::query(std::span<const std::byte> request) -> std::vector<std::byte> {
+    std::optional<std::vector<std::string_view>> arguments;
+    if (request.size() >= sizeof(Command) + sizeof(unsigned long) && std::to_underlying(request.front()) < commandCount)
+        arguments = Frame::decodeArguments(request.subspan(sizeof(Command) + sizeof(unsigned long)));
+    if (!arguments.has_value()) {
+        constexpr std::string_view response{"(error) ERR Protocol error: invalid request"};
+        const auto bytes{std::as_bytes(std::span{response})};
+
+        return {bytes.cbegin(), bytes.cend()};
+    }
 
-                response = this->databases.at(index).rename(statement);
-                isRecord = true;
+    unsigned long index;
+    std::memcpy(&index, request.data() + sizeof(Command), sizeof(index));
 
-                break;
-            }
-        case Command::renamenx:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    const std::string response{this->query(static_cast<Command>(request.front()), index, *arguments).toString()};
+    const auto bytes{std::as_bytes(std::span{response})};
 
-                response = this->databases.at(index).renamenx(statement);
-                isRecord = true;
+    return {bytes.cbegin(), bytes.cend()};
+}
 
-                break;
-            }
-        case Command::type:
-            {
-                const std::shared_lock sharedLock{this->lock};
+auto DatabaseManager::query(Command command, const unsigned long index, std::span<const std::string_view> arguments)
+    -> Reply {
+    if (!getSpecification(command).isArityValid(arguments.size()))
+        return Reply{Reply::Type::error, "ERR wrong number of arguments"};
 
-                response = this->databases.at(index).type(statement);
+    if (getSpecification(command).lock == CommandSpecification::Lock::none)
+        return this->read(command, index, arguments);
 
-                break;
-            }
-        case Command::set:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    const std::shared_lock snapshotSharedLock{this->snapshotLock};
 
-                response = this->databases.at(index).set(statement);
-                isRecord = true;
+    const std::vector normalizedArguments{normalize(command, arguments)};
+    const std::vector<std::string_view> normalizedArgumentViews{normalizedArguments.cbegin(),
+                                                                normalizedArguments.cend()};
+    if (!normalizedArgumentViews.empty()) arguments = normalizedArgumentViews;
 
-                break;
-            }
-        case Command::get:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    const CommandSpecification &specification{getSpecification(command)};
+    if (Config::getMaxmemory() != 0 && specification.isDenyOom && !this->evict())
+        return Reply{Reply::Type::error, "OOM command not allowed when used memory > 'maxmemory'"};
 
-                response = this->databases.at(index).get(statement);
+    const Handler handler{getHandler(command)};
+    Reply response;
+    ShardLock::reset();
+    if (specification.lock == CommandSpecification::Lock::exclusive) {
+        const std::lock_guard lockGuard{this->lock};
 
-                break;
-            }
-        case Command::getRange:
-            {
-                const std::shared_lock sharedLock{this->lock};
+        response = handler(*this, this->databases.at(index), arguments);
+    } else {
+        const std::shared_lock sharedLock{this->lock};
 
-                response = this->databases.at(index).getRange(statement);
+        response = handler(*this, this->databases.at(index), arguments);
+    }
+    if (specification.isWrite) {
+        this->record(command, index, arguments);
 
-                break;
-            }
-        case Command::getBit:
-            {
-                const std::shared_lock sharedLock{this->lock};
+        if (Config::getMaxmemory() != 0) {
+            const std::shared_lock sharedLock{this->lock};
 
-                response = this->databases.at(index).getBit(statement);
+            Database &database{this->databases.at(index)};
+            specification.forEachKey(arguments, [&database](const std::string_view key) { database.refresh(key); });
+        }
+    }
 
-                break;
-            }
-        case Command::setBit:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    return response;
+}
 
-                response = this->databases.at(index).setBit(statement);
-                isRecord = true;
+auto DatabaseManager::activeExpire() -> void {
+    const auto deadline{std::chrono::steady_clock::now() + std::chrono::milliseconds{25}};
 
-                break;
-            }
-        case Command::mget:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    const std::shared_lock sharedLock{this->lock};
 
-                response = this->databases.at(index).mget(statement);
+    for (auto &database : this->databases | std::views::values) {
+        database.activeExpire(deadline);
 
-                break;
-            }
-        case Command::setnx:
-            {
-                const std::shared_lock sharedLock{this->lock};
+        if (std::chrono::steady_clock::now() >= deadline) break;
+    }
+}
 
-                response = this->databases.at(index).setnx(statement);
-                isRecord = true;
+auto DatabaseManager::isWritable() -> bool {
+    ++this->seconds;
 
-                break;
-            }
-        case Command::setRange:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    const std::lock_guard snapshotLockGuard{this->snapshotLock};
+    const std::lock_guard lockGuard{this->lock};
 
-                response = this->databases.at(index).setRange(statement);
-                isRecord = true;
+    this->drain();
+    if (!this->writeBuffer.empty()) return false;
 
-                break;
-            }
-        case Command::strlen:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    if (this->snapshotThread.joinable()) {
+        if (this->isSnapshotted.load(std::memory_order::acquire)) {
+            this->snapshotThread.join();
+            this->isSnapshotted.store(false, std::memory_order::relaxed);
 
-                response = this->databases.at(index).strlen(statement);
+            this->seconds = std::chrono::seconds::zero();
+            this->aofBuffer.clear();
+            this->writeBuffer = std::move(this->snapshotBuffer);
+            this->writeBuffer.insert(this->writeBuffer.cend(), this->snapshotAofBuffer.cbegin(),
+                                     this->snapshotAofBuffer.cend());
+            this->snapshotAofBuffer = {};
 
-                break;
-            }
-        case Command::mset:
-            {
-                const std::shared_lock sharedLock{this->lock};
+            return true;
+        }
+    } else if ((this->seconds >= std::chrono::seconds{900} && this->writeCount > 1) ||
+               (this->seconds >= std::chrono::seconds{300} && this->writeCount > 10) ||
+               (this->seconds >= std::chrono::seconds{60} && this->writeCount > 10000)) {
+        this->writeCount = 0;
+        this->snapshot();
+    }
 
-                response = this->databases.at(index).mset(statement);
-                isRecord = true;
+    if (!this->aofBuffer.empty()) {
+        this->writeBuffer = std::move(this->aofBuffer);
 
-                break;
-            }
-        case Command::msetnx:
-            {
-                const std::shared_lock sharedLock{this->lock};
+        return true;
+    }
 
-                response = this->databases.at(index).msetnx(statement);
-                isRecord = true;
+    return false;
+}
 
-                break;
-            }
-        case Command::incr:
-            {
-                const std::shared_lock sharedLock{this->lock};
+auto DatabaseManager::isTruncatable() const noexcept -> bool {
+    return this->seconds == std::chrono::seconds::zero() && !this->writeBuffer.empty();
+}
 
-                response = this->databases.at(index).incr(statement);
-                isRecord = true;
+auto DatabaseManager::truncate() const noexcept -> Awaiter {
+    Awaiter awaiter;
+    awaiter.setSubmission(Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, Submission::Truncate{}});
 
-                break;
-            }
-        case Command::incrBy:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    return awaiter;
+}
 
-                response = this->databases.at(index).incrBy(statement);
-                isRecord = true;
+auto DatabaseManager::write() const noexcept -> Awaiter {
+    Awaiter awaiter;
+    awaiter.setSubmission(Submission{
+        this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, Submission::Write{this->writeBuffer, 0}
+    });
 
-                break;
-            }
-        case Command::decr:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    return awaiter;
+}
 
-                response = this->databases.at(index).decr(statement);
-                isRecord = true;
+auto DatabaseManager::wrote() noexcept -> void { this->writeBuffer.clear(); }
 
-                break;
-            }
-        case Command::decrBy:
-            {
-                const std::shared_lock sharedLock{this->lock};
+auto DatabaseManager::getHandler(const Command command) noexcept -> Handler {
+    static constexpr std::array<std::pair<Command, Handler>, commandCount> handlers{{
+        {Command::select, select},
+        {Command::del, call<&Database::del>},
+        {Command::exists, call<&Database::exists>},
+        {Command::move, move},
+        {Command::rename, call<&Database::rename>},
+        {Command::renamenx, call<&Database::renamenx>},
+        {Command::type, call<&Database::type>},
+        {Command::scan, call<&Database::scan>},
+        {Command::range, call<&Database::range>},
+        {Command::expire, call<&Database::expire>},
+        {Command::expireAt, call<&Database::expireAt>},
+        {Command::pexpire, call<&Database::pexpire>},
+        {Command::pexpireAt, call<&Database::pexpireAt>},
+        {Command::persist, call<&Database::persist>},
+        {Command::pttl, call<&Database::pttl>},
+        {Command::ttl, call<&Database::ttl>},
+        {Command::set, call<&Database::set>},
+        {Command::get, call<&Database::get>},
+        {Command::getRange, call<&Database::getRange>},
+        {Command::getBit, call<&Database::getBit>},
+        {Command::setBit, call<&Database::setBit>},
+        {Command::bitCount, call<&Database::bitCount>},
+        {Command::bitPos, call<&Database::bitPos>},
+        {Command::bitOp, call<&Database::bitOp>},
+        {Command::bitField, call<&Database::bitField>},
+        {Command::mget, call<&Database::mget>},
+        {Command::setnx, call<&Database::setnx>},
+        {Command::setRange, call<&Database::setRange>},
+        {Command::strlen, call<&Database::strlen>},
+        {Command::mset, call<&Database::mset>},
+        {Command::msetnx, call<&Database::msetnx>},
+        {Command::incr, call<&Database::incr>},
+        {Command::incrBy, call<&Database::incrBy>},
+        {Command::decr, call<&Database::decr>},
+        {Command::decrBy, call<&Database::decrBy>},
+        {Command::append, call<&Database::append>},
+        {Command::hdel, call<&Database::hdel>},
+        {Command::hexists, call<&Database::hexists>},
+        {Command::hget, call<&Database::hget>},
+        {Command::hgetAll, call<&Database::hgetAll>},
+        {Command::hincrBy, call<&Database::hincrBy>},
+        {Command::hkeys, call<&Database::hkeys>},
+        {Command::hlen, call<&Database::hlen>},
+        {Command::hscan, call<&Database::hscan>},
+        {Command::hset, call<&Database::hset>},
+        {Command::hvals, call<&Database::hvals>},
+        {Command::lindex, call<&Database::lindex>},
+        {Command::llen, call<&Database::llen>},
+        {Command::lpop, call<&Database::lpop>},
+        {Command::lpush, call<&Database::lpush>},
+        {Command::lpushx, call<&Database::lpushx>},
+        {Command::linsert, call<&Database::linsert>},
+        {Command::lrange, call<&Database::lrange>},
+        {Command::lrem, call<&Database::lrem>},
+        {Command::lset, call<&Database::lset>},
+        {Command::ltrim, call<&Database::ltrim>},
+        {Command::rpop, call<&Database::rpop>},
+        {Command::rpush, call<&Database::rpush>},
+        {Command::sadd, call<&Database::sadd>},
+        {Command::scard, call<&Database::scard>},
+        {Command::sdiff, call<&Database::sdiff>},
+        {Command::sinter, call<&Database::sinter>},
+        {Command::sinterCard, call<&Database::sinterCard>},
+        {Command::sismember, call<&Database::sismember>},
+        {Command::smembers, call<&Database::smembers>},
+        {Command::srem, call<&Database::srem>},
+        {Command::sscan, call<&Database::sscan>},
+        {Command::sunion, call<&Database::sunion>},
+        {Command::zadd, call<&Database::zadd>},
+        {Command::zcount, call<&Database::zcount>},
+        {Command::zincrBy, call<&Database::zincrBy>},
+        {Command::zrange, call<&Database::zrange>},
+        {Command::zrangeByScore, call<&Database::zrangeByScore>},
+        {Command::zrank, call<&Database::zrank>},
+        {Command::zrem, call<&Database::zrem>},
+        {Command::zscore, call<&Database::zscore>},
+        {Command::pfAdd, call<&Database::pfAdd>},
+        {Command::pfCount, call<&Database::pfCount>},
+        {Command::pfMerge, call<&Database::pfMerge>},
+        {Command::bfReserve, call<&Database::bfReserve>},
+        {Command::bfAdd, call<&Database::bfAdd>},
+        {Command::bfMadd, call<&Database::bfMadd>},
+        {Command::bfExists, call<&Database::bfExists>},
+        {Command::bfMexists, call<&Database::bfMexists>},
+        {Command::cmsInitByDim, call<&Database::cmsInitByDim>},
+        {Command::cmsInitByProb, call<&Database::cmsInitByProb>},
+        {Command::cmsIncrBy, call<&Database::cmsIncrBy>},
+        {Command::cmsQuery, call<&Database::cmsQuery>},
+        {Command::topkReserve, call<&Database::topkReserve>},
+        {Command::topkAdd, call<&Database::topkAdd>},
+        {Command::topkList, call<&Database::topkList>},
+    }};
+    static_assert([] {
+        for (unsigned char i{}; i < commandCount; ++i)
+            if (std::to_underlying(handlers[i].first) != i) return false;
+
+        return true;
+    }());
+
+    return handlers[std::to_underlying(command)].second;
+}
 
-                response = this->databases.at(index).decrBy(statement);
-                isRecord = true;
+auto DatabaseManager::select(DatabaseManager &databaseManager, Database &,
+                             const std::span<const std::string_view> arguments) -> Reply {
+    const std::optional target{Entry::parseInteger(arguments.front())};
+    if (!target.has_value() || *target < 0) return Reply{Reply::Type::error, "ERR DB index is out of range"};
 
-                break;
-            }
-        case Command::append:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    const auto targetIndex{static_cast<unsigned long>(*target)};
+    if (databaseManager.databases.try_emplace(targetIndex, Database{targetIndex, std::span<const std::byte>{}}).second)
+        databaseManager.publish();
 
-                response = this->databases.at(index).append(statement);
-                isRecord = true;
+    return Reply{Reply::Type::status, "OK"};
+}
 
-                break;
-            }
-        case Command::hdel:
-            {
-                const std::shared_lock sharedLock{this->lock};
+auto DatabaseManager::move(DatabaseManager &databaseManager, Database &database,
+                           const std::span<const std::string_view> arguments) -> Reply {
+    return database.move(databaseManager.databases, arguments);
+}
 
-                response = this->databases.at(index).hdel(statement);
-                isRecord = true;
+auto DatabaseManager::evict() -> bool {
+    bool isEvicted{true};
 
-                break;
-            }
-        case Command::hexists:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    {
+        const std::shared_lock sharedLock{this->lock};
+        const std::lock_guard lockGuard{this->evictionLock};
 
-                response = this->databases.at(index).hexists(statement);
+        while (this->getMemory() > Config::getMaxmemory()) {
+            if (Config::getMaxmemoryPolicy() == Config::MaxmemoryPolicy::noeviction) {
+                isEvicted = false;
 
                 break;
             }
-        case Command::hget:
-            {
-                const std::shared_lock sharedLock{this->lock};
 
-                response = this->databases.at(index).hget(statement);
+            std::vector<Database::EvictionCandidate> candidates;
+            for (auto &database : this->databases | std::views::values) database.sample(candidates);
 
-                break;
-            }
-        case Command::hgetAll:
-            {
-                const std::shared_lock sharedLock{this->lock};
-
-                response = this->databases.at(index).hgetAll(statement);
+            for (auto &candidate : candidates) {
+                if (std::ranges::any_of(this->evictionPool, [&candidate](const Database::EvictionCandidate &pooled) {
+                        return pooled.database == candidate.database && pooled.key == candidate.key;
+                    }))
+                    continue;
 
-                break;
+                this->evictionPool.insert(std::ranges::upper_bound(this->evictionPool, candidate.idle, {},
+                                                                   &Database::EvictionCandidate::idle),
+                                          std::move(candidate));
+                if (this->evictionPool.size() > evictionPoolSize) this->evictionPool.erase(this->evictionPool.cbegin());
             }
-        case Command::hincrBy:
-            {
-                const std::shared_lock sharedLock{this->lock};
 
-                response = this->databases.at(index).hincrBy(statement);
-                isRecord = true;
+            bool isFound{};
+            while (!this->evictionPool.empty() && !isFound) {
+                const Database::EvictionCandidate candidate{std::move(this->evictionPool.back())};
+                this->evictionPool.pop_back();
 
-                break;
-            }
-        case Command::hkeys:
-            {
-                const std::shared_lock sharedLock{this->lock};
+                ShardLock::reset();
+                if (const auto result{this->databases.find(candidate.database)};
+                    result != this->databases.cend() && result->second.evict(candidate.key)) {
+                    this->record(Command::del, candidate.database, std::array{std::string_view{candidate.key}});
 
-                response = this->databases.at(index).hkeys(statement);
-
-                break;
+                    isFound = true;
+                }
             }
-        case Command::hlen:
-            {
-                const std::shared_lock sharedLock{this->lock};
 
-                response = this->databases.at(index).hlen(statement);
+            if (!isFound) {
+                isEvicted = false;
 
                 break;
             }
-        case Command::hset:
-            {
-                const std::shared_lock sharedLock{this->lock};
+        }
+    }
 
-                response = this->databases.at(index).hset(statement);
-                isRecord = true;
+    return isEvicted;
+}
 
-                break;
-            }
-        case Command::hvals:
-            {
-                const std::shared_lock sharedLock{this->lock};
+auto DatabaseManager::getMemory() const noexcept -> unsigned long {
+    unsigned long memory{};
+    for (const auto &database : this->databases | std::views::values) memory += database.getMemory();
 
-                response = this->databases.at(index).hvals(statement);
+    return memory;
+}
 
-                break;
-            }
-        case Command::lindex:
+auto DatabaseManager::normalize(Command &command, const std::span<const std::string_view> arguments)
+    -> std::vector<std::string> {
+    switch (command) {
+        case Command::set:
             {
-                const std::shared_lock sharedLock{this->lock};
-
-                response = this->databases.at(index).lindex(statement);
+                const std::optional deadline{Database::parseExpiration(arguments.subspan(2))};
+                if (!deadline.has_value() || *deadline == 0) return {};
 
-                break;
+                return {std::string{arguments[0]}, std::string{arguments[1]}, "PXAT", std::to_string(*deadline)};
             }
-        case Command::llen:
+        case Command::expire:
+        case Command::expireAt:
+        case Command::pexpire:
             {
-                const std::shared_lock sharedLock{this->lock};
+                const std::optional time{Entry::parseInteger(arguments[1])};
+                if (!time.has_value()) return {};
 
-                response = this->databases.at(index).llen(statement);
+                const std::optional deadline{Database::getDeadline(
+                    command == Command::expire ? "EX" : command == Command::expireAt ? "EXAT" : "PX", *time)};
+                if (!deadline.has_value()) return {};
 
-                break;
-            }
-        case Command::lpop:
-            {
-                const std::shared_lock sharedLock{this->lock};
+                command = Command::pexpireAt;
 
-                response = this->databases.at(index).lpop(statement);
-                isRecord = true;
-
-                break;
+                return {std::string{arguments[0]}, std::to_string(*deadline)};
             }
-        case Command::lpush:
-            {
-                const std::shared_lock sharedLock{this->lock};
+        default:
+            return {};
+    }
+}
 
-                response = this->databases.at(index).lpush(statement);
-                isRecord = true;
+auto DatabaseManager::read(const Command command, const unsigned long index,
+                           const std::span<const std::string_view> arguments) -> Reply {
+    const Epoch::Guard guard;
 
-                break;
-            }
-        case Command::lpushx:
-            {
-                const std::shared_lock sharedLock{this->lock};
+    return getHandler(command)(*this, *this->view.load(std::memory_order::acquire)->at(index), arguments);
+}
 
-                response = this->databases.at(index).lpushx(statement);
-                isRecord = true;
+auto DatabaseManager::publish() -> void {
+    auto view{std::make_unique<std::unordered_map<unsigned long, Database *>>()};
+    for (auto &[index, database] : this->databases) view->emplace(index, &database);
 
-                break;
-            }
-    }
-    if (isRecord) this->record(requestCopy);
-    const auto bytes{std::as_bytes(std::span{response})};
-
-    return {bytes.cbegin(), bytes.cend()};
+    if (const auto oldView{this->view.exchange(view.release(), std::memory_order::acq_rel)}; oldView != nullptr)
+        Epoch::retire(oldView, deleteView);
 }
 
-auto DatabaseManager::isWritable() -> bool {
-    ++this->seconds;
+auto DatabaseManager::deleteView(void *const view) noexcept -> void {
+    delete static_cast<std::unordered_map<unsigned long, Database *> *>(view);
+}
 
-    if (const std::lock_guard lockGuard{this->lock}; this->writeBuffer.empty()) {
-        if ((this->seconds >= std::chrono::seconds{900} && this->writeCount > 1) ||
-            (this->seconds >= std::chrono::seconds{300} && this->writeCount > 10) ||
-            (this->seconds >= std::chrono::seconds{60} && this->writeCount > 10000)) {
-            this->seconds = std::chrono::seconds::zero();
-            this->aofBuffer.clear();
-            this->writeCount = 0;
-            this->writeBuffer = this->serialize();
+auto DatabaseManager::getAofBuffer() -> AofBuffer & {
+    thread_local std::pair<unsigned long, AofBuffer *> cache{-1UL, nullptr};
+    if (cache.first == this->instance) return *cache.second;
 
-            return true;
-        }
+    const std::lock_guard lockGuard{this->aofBuffersLock};
 
-        if (!this->aofBuffer.empty()) {
-            this->writeBuffer = std::move(this->aofBuffer);
+    cache = {this->instance, this->aofBuffers.emplace_back(std::make_unique<AofBuffer>()).get()};
 
-            return true;
-        }
-    }
-
-    return false;
+    return *cache.second;
 }
 
-auto DatabaseManager::isTruncatable() const noexcept -> bool {
-    return this->seconds == std::chrono::seconds::zero() && !this->writeBuffer.empty();
-}
+auto DatabaseManager::record(const Command command, const unsigned long index,
+                             const std::span<const std::string_view> arguments) -> void {
+    AofBuffer &aofBuffer{this->getAofBuffer()};
+    aofBuffer.sequences.emplace_back(ShardLock::takeSequence());
 
-auto DatabaseManager::truncate() const noexcept -> Awaiter {
-    Awaiter awaiter;
-    awaiter.setSubmission(Submission{this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, Submission::Truncate{}});
+    const unsigned long sizePosition{aofBuffer.data.size()};
+    aofBuffer.data.resize(sizePosition + sizeof(unsigned long));
+    aofBuffer.data.emplace_back(static_cast<std::byte>(command));
+    aofBuffer.data.resize(aofBuffer.data.size() + sizeof(index));
+    std::memcpy(aofBuffer.data.data() + aofBuffer.data.size() - sizeof(index), &index, sizeof(index));
+    Frame::encodeArguments(aofBuffer.data, arguments);
 
-    return awaiter;
+    const unsigned long requestSize{aofBuffer.data.size() - sizePosition - sizeof(requestSize)};
+    std::memcpy(aofBuffer.data.data() + sizePosition, &requestSize, sizeof(requestSize));
 }
 
-auto DatabaseManager::write() const noexcept -> Awaiter {
-    Awaiter awaiter;
-    awaiter.setSubmission(Submission{
-        this->getFileDescriptor(), IOSQE_FIXED_FILE, 0, Submission::Write{this->writeBuffer, 0}
-    });
+auto DatabaseManager::drain() -> void {
+    struct Cursor {
+        const AofBuffer *aofBuffer;
+        unsigned long index, offset;
+    };
 
-    return awaiter;
-}
+    std::vector<Cursor> cursors;
+    for (const auto &aofBuffer : this->aofBuffers)
+        if (!aofBuffer->sequences.empty()) cursors.emplace_back(aofBuffer.get(), 0, 0);
 
-auto DatabaseManager::wrote() noexcept -> void { this->writeBuffer.clear(); }
+    while (!cursors.empty()) {
+        const auto cursor{std::ranges::min_element(
+            cursors, {}, [](const Cursor &cursor) noexcept { return cursor.aofBuffer->sequences[cursor.index]; })};
 
-auto DatabaseManager::record(const std::span<const std::byte> request) -> void {
-    const std::lock_guard lockGuard{this->lock};
+        unsigned long requestSize;
+        std::memcpy(&requestSize, cursor->aofBuffer->data.data() + cursor->offset, sizeof(requestSize));
+        const auto first{cursor->aofBuffer->data.cbegin() + static_cast<long>(cursor->offset)},
+            last{first + static_cast<long>(sizeof(requestSize) + requestSize)};
 
-    const unsigned long requestSize{request.size()};
-    this->aofBuffer.insert(this->aofBuffer.cend(), sizeof(requestSize), std::byte{});
-    *reinterpret_cast<std::remove_const_t<decltype(requestSize)> *>(this->aofBuffer.data() + this->aofBuffer.size() -
-                                                                    sizeof(requestSize)) = requestSize;
+        this->aofBuffer.insert(this->aofBuffer.cend(), first, last);
+        if (this->snapshotThread.joinable())
+            this->snapshotAofBuffer.insert(this->snapshotAofBuffer.cend(), first, last);
+        ++this->writeCount;
 
-    this->aofBuffer.insert(this->aofBuffer.cend(), request.cbegin(), request.cend());
+        cursor->offset += sizeof(requestSize) + requestSize;
+        if (++cursor->index == cursor->aofBuffer->sequences.size()) cursors.erase(cursor);
+    }
 
-    ++this->writeCount;
+    for (const auto &aofBuffer : this->aofBuffers) {
+        aofBuffer->data.clear();
+        aofBuffer->sequences.clear();
+    }
 }
 
-auto DatabaseManager::serialize() -> std::vector<std::byte> {
-    const unsigned long size{this->databases.size()};
-    std::vector<std::byte> serialization{sizeof(size)};
-    *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serialization.data()) = size;
-
-    for (auto &value : this->databases | std::views::values) {
-        const std::vector subSerialization{value.serialize()};
-        serialization.insert(serialization.cend(), subSerialization.cbegin(), subSerialization.cend());
+auto DatabaseManager::snapshot() -> void {
+    std::vector<Database *> databases;
+    for (auto &database : this->databases | std::views::values) {
+        database.snapshot();
+        databases.emplace_back(&database);
     }
 
-    return serialization;
+    this->snapshotThread = std::jthread{[this, databases{std::move(databases)}] {
+        const unsigned long size{databases.size()};
+        std::vector<std::byte> serialization{sizeof(size)};
+        *reinterpret_cast<std::remove_const_t<decltype(size)> *>(serialization.data()) = size;
+
+        for (Database *const database : databases) {
+            const std::vector subSerialization{database->serialize()};
+            serialization.insert(serialization.cend(), subSerialization.cbegin(), subSerialization.cend());
+        }
+
+        this->snapshotBuffer = std::move(serialization);
+        this->isSnapshotted.store(true, std::memory_order::release);
+    }};
 }
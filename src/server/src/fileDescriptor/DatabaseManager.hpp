@@ -1,18 +1,41 @@
 #pragma once
 
+#include "../../../common/command/Command.hpp"
 #include "../database/Database.hpp"
 #include "FileDescriptor.hpp"
 
 #include <source_location>
+#include <thread>
 
 class DatabaseManager : public FileDescriptor {
+    struct AofBuffer {
+        std::vector<std::byte> data;
+        std::vector<unsigned long> sequences;
+    };
+
 public:
     [[nodiscard]] static auto create(std::source_location sourceLocation = std::source_location::current()) -> int;
 
+    [[nodiscard]] static auto getKey(std::span<const std::byte> request) noexcept -> std::string_view;
+
     explicit DatabaseManager(int fileDescriptor);
 
+    DatabaseManager(const DatabaseManager &) = delete;
+
+    DatabaseManager(DatabaseManager &&) = delete;
+
+    auto operator=(const DatabaseManager &) -> DatabaseManager & = delete;
+
+    auto operator=(DatabaseManager &&) -> DatabaseManager & = delete;
+
+    ~DatabaseManager();
+
     auto query(std::span<const std::byte> request) -> std::vector<std::byte>;
 
+    auto query(Command command, unsigned long index, std::span<const std::string_view> arguments) -> Reply;
+
+    auto activeExpire() -> void;
+
     [[nodiscard]] auto isWritable() -> bool;
 
     [[nodiscard]] auto isTruncatable() const noexcept -> bool;
@@ -24,13 +47,60 @@ public:
     auto wrote() noexcept -> void;
 
 private:
-    auto record(std::span<const std::byte> request) -> void;
+    using Handler = auto (*)(DatabaseManager &databaseManager, Database &database,
+                             std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] static auto getHandler(Command command) noexcept -> Handler;
+
+    template <auto (Database::*method)(std::span<const std::string_view> arguments)->Reply>
+    [[nodiscard]] static auto call(DatabaseManager &, Database &database,
+                                   const std::span<const std::string_view> arguments) -> Reply {
+        return (database.*method)(arguments);
+    }
+
+    [[nodiscard]] static auto select(DatabaseManager &databaseManager, Database &,
+                                     std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] static auto move(DatabaseManager &databaseManager, Database &database,
+                                   std::span<const std::string_view> arguments) -> Reply;
+
+    [[nodiscard]] auto evict() -> bool;
+
+    [[nodiscard]] auto getMemory() const noexcept -> unsigned long;
+
+    [[nodiscard]] static auto normalize(Command &command, std::span<const std::string_view> arguments)
+        -> std::vector<std::string>;
+
+    [[nodiscard]] auto read(Command command, unsigned long index, std::span<const std::string_view> arguments)
+        -> Reply;
+
+    auto publish() -> void;
+
+    static auto deleteView(void *view) noexcept -> void;
+
+    [[nodiscard]] auto getAofBuffer() -> AofBuffer &;
+
+    auto record(Command command, unsigned long index, std::span<const std::string_view> arguments) -> void;
+
+    auto drain() -> void;
+
+    auto snapshot() -> void;
+
+    static constexpr unsigned long evictionPoolSize{16};
 
-    [[nodiscard]] auto serialize() -> std::vector<std::byte>;
+    static constinit std::atomic<unsigned long> instanceCount;
 
     std::unordered_map<unsigned long, Database> databases;
-    std::shared_mutex lock;
-    std::vector<std::byte> aofBuffer, writeBuffer;
+    std::atomic<std::unordered_map<unsigned long, Database *> *> view{};
+    std::shared_mutex lock, snapshotLock;
+    std::mutex evictionLock;
+    std::vector<Database::EvictionCandidate> evictionPool;
+    std::vector<std::byte> aofBuffer, writeBuffer, snapshotBuffer, snapshotAofBuffer;
+    const unsigned long instance;
+    std::mutex aofBuffersLock;
+    std::vector<std::unique_ptr<AofBuffer>> aofBuffers;
     std::chrono::seconds seconds{};
     unsigned long writeCount{};
+    std::atomic_bool isSnapshotted{};
+    std::jthread snapshotThread;
 };
@@ -1,6 +1,8 @@
+#include "config/Config.hpp"
 #include "coroutine/Scheduler.hpp"
 
-auto main() -> int {
+auto main(const int argc, const char *const argv[]) -> int {
+    Config::parse(std::span{argv + 1, static_cast<unsigned long>(argc - 1)});
     Scheduler::registerSignal();
 
     std::atomic_uint cpuCode;
@@ -9,7 +11,7 @@ auto main() -> int {
     std::vector<std::jthread> workers{std::jthread::hardware_concurrency() - 1};
     for (const int sharedFileDescriptor{scheduler.getRingFileDescriptor()}; auto &worker : workers) {
         worker = std::jthread{[sharedFileDescriptor, &cpuCode] {
-            Scheduler otherScheduler{sharedFileDescriptor, cpuCode++, false};
+            Scheduler otherScheduler{sharedFileDescriptor, ++cpuCode, false};
             otherScheduler.run();
         }};
     }
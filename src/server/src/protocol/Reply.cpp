@@ -0,0 +1,57 @@
+#include "Reply.hpp"
+
+Reply::Reply(const Type type, std::string &&text) noexcept : type{type}, value{std::move(text)} {}
+
+Reply::Reply(const long integer) noexcept : type{Type::integer}, value{integer} {}
+
+Reply::Reply(std::vector<Reply> &&elements) noexcept : type{Type::array}, value{std::move(elements)} {}
+
+auto Reply::getType() const noexcept -> Type { return this->type; }
+
+auto Reply::getText() const noexcept -> std::string_view { return *std::get_if<std::string>(&this->value); }
+
+auto Reply::getInteger() const noexcept -> long { return *std::get_if<long>(&this->value); }
+
+auto Reply::getElements() const noexcept -> std::span<const Reply> {
+    return *std::get_if<std::vector<Reply>>(&this->value);
+}
+
+auto Reply::toString() const -> std::string {
+    switch (this->type) {
+        case Type::status:
+            return std::string{this->getText()};
+        case Type::error:
+            return "(error) " + std::string{this->getText()};
+        case Type::integer:
+            return "(integer) " + std::to_string(this->getInteger());
+        case Type::bulk:
+            return '"' + std::string{this->getText()} + '"';
+        case Type::nil:
+            return "(nil)";
+        case Type::array:
+            break;
+    }
+
+    const std::span elements{this->getElements()};
+    if (elements.empty()) return "(empty array)";
+
+    std::string result;
+    for (unsigned long i{}; i < elements.size(); ++i) {
+        const std::string prefix{std::to_string(i + 1) + ") "};
+        if (i != 0) result += '\n';
+        result += prefix;
+
+        if (elements[i].type != Type::array) {
+            result += elements[i].toString();
+
+            continue;
+        }
+
+        for (const char character : elements[i].toString()) {
+            result += character;
+            if (character == '\n') result.append(prefix.size(), ' ');
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+class Reply {
+public:
+    enum class Type : unsigned char { status, error, integer, bulk, nil, array };
+
+    explicit Reply(Type type = Type::nil, std::string &&text = {}) noexcept;
+
+    explicit Reply(long integer) noexcept;
+
+    explicit Reply(std::vector<Reply> &&elements) noexcept;
+
+    [[nodiscard]] auto getType() const noexcept -> Type;
+
+    [[nodiscard]] auto getText() const noexcept -> std::string_view;
+
+    [[nodiscard]] auto getInteger() const noexcept -> long;
+
+    [[nodiscard]] auto getElements() const noexcept -> std::span<const Reply>;
+
+    [[nodiscard]] auto toString() const -> std::string;
+
+private:
+    Type type;
+    std::variant<std::string, long, std::vector<Reply>> value;
+};
@@ -0,0 +1,196 @@
+#include "Resp.hpp"
+
+#include "../fileDescriptor/DatabaseManager.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+auto Resp::detect(const std::span<const std::byte> data) noexcept -> std::optional<bool> {
+    if (data.empty()) return std::nullopt;
+    if (data.front() != std::byte{'*'}) return false;
+    if (data.size() < sizeof(unsigned long)) return std::nullopt;
+
+    return std::ranges::any_of(data.subspan(sizeof(unsigned int), sizeof(unsigned int)),
+                               [](const std::byte byte) noexcept { return byte != std::byte{}; });
+}
+
+auto Resp::process(std::span<const std::byte> &data, DatabaseManager &databaseManager)
+    -> std::optional<std::vector<std::byte>> {
+    std::string responses;
+
+    bool isMalformed{};
+    while (const std::optional arguments{decode(data, isMalformed)}) {
+        if (!arguments->empty()) responses += this->execute(*arguments, databaseManager);
+    }
+    if (isMalformed) return std::nullopt;
+
+    const auto bytes{std::as_bytes(std::span{responses})};
+
+    return std::vector<std::byte>{bytes.begin(), bytes.end()};
+}
+
+auto Resp::decode(std::span<const std::byte> &data, bool &isMalformed)
+    -> std::optional<std::vector<std::string_view>> {
+    std::string_view text{reinterpret_cast<const char *>(data.data()), data.size()};
+
+    const std::optional count{parseLength(text, '*', isMalformed)};
+    if (!count.has_value()) return std::nullopt;
+    if (*count < 0 || static_cast<unsigned long>(*count) > maxArgumentCount) {
+        isMalformed = true;
+
+        return std::nullopt;
+    }
+
+    std::vector<std::string_view> arguments;
+    arguments.reserve(*count);
+    for (long i{}; i < *count; ++i) {
+        const std::optional size{parseLength(text, '$', isMalformed)};
+        if (!size.has_value()) return std::nullopt;
+        if (*size < 0 || static_cast<unsigned long>(*size) > maxBulkSize) {
+            isMalformed = true;
+
+            return std::nullopt;
+        }
+
+        const auto length{static_cast<unsigned long>(*size)};
+        if (text.size() < length + 2) return std::nullopt;
+        if (text.substr(length, 2) != "\r\n") {
+            isMalformed = true;
+
+            return std::nullopt;
+        }
+
+        arguments.emplace_back(text.substr(0, length));
+        text.remove_prefix(length + 2);
+    }
+    data = data.last(text.size());
+
+    return arguments;
+}
+
+auto Resp::parseLength(std::string_view &text, const char prefix, bool &isMalformed) noexcept
+    -> std::optional<long> {
+    if (text.empty()) return std::nullopt;
+    if (text.front() != prefix) {
+        isMalformed = true;
+
+        return std::nullopt;
+    }
+
+    const unsigned long end{text.find("\r\n")};
+    if (end == std::string_view::npos) {
+        if (text.size() > maxLineSize) isMalformed = true;
+
+        return std::nullopt;
+    }
+
+    long length;
+    if (const auto [pointer, error]{std::from_chars(text.data() + 1, text.data() + end, length)};
+        error != std::errc{} || pointer != text.data() + end) {
+        isMalformed = true;
+
+        return std::nullopt;
+    }
+    text.remove_prefix(end + 2);
+
+    return length;
+}
+
+auto Resp::encodeBulk(const std::string_view value) -> std::string {
+    std::string result{'$' + std::to_string(value.size()) + "\r\n"};
+    result += value;
+    result += "\r\n";
+
+    return result;
+}
+
+auto Resp::execute(const std::span<const std::string_view> arguments, DatabaseManager &databaseManager)
+    -> std::string {
+    std::string name{arguments.front()};
+    std::ranges::transform(name, name.begin(), [](const char character) noexcept {
+        return static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+    });
+
+    if (name == "PING") return arguments.size() > 1 ? encodeBulk(arguments[1]) : "+PONG\r\n";
+    if (name == "ECHO" && arguments.size() == 2) return encodeBulk(arguments[1]);
+    if (name == "HELLO") return this->hello(arguments);
+    if (name == "QUIT" || name == "CLIENT") return "+OK\r\n";
+    if (name == "COMMAND") return "*0\r\n";
+    if (name == "CONFIG") return this->version == 3 ? "%0\r\n" : "*0\r\n";
+
+    const std::optional command{toCommand(name)};
+    if (!command.has_value()) return "-ERR unknown command '" + std::string{arguments.front()} + "'\r\n";
+
+    const Reply reply{databaseManager.query(*command, this->databaseIndex, arguments.subspan(1))};
+    if (*command == Command::select && reply.getType() != Reply::Type::error)
+        std::from_chars(arguments[1].data(), arguments[1].data() + arguments[1].size(), this->databaseIndex);
+
+    return this->encode(*command, reply);
+}
+
+auto Resp::hello(const std::span<const std::string_view> arguments) -> std::string {
+    if (arguments.size() > 1) {
+        if (arguments[1] == "2") this->version = 2;
+        else if (arguments[1] == "3") this->version = 3;
+        else return "-NOPROTO unsupported protocol version\r\n";
+    }
+
+    std::string result{this->version == 3 ? "%4\r\n" : "*8\r\n"};
+    result += encodeBulk("server") + encodeBulk("tinyRedis");
+    result += encodeBulk("version") + encodeBulk("7.0.0");
+    result += encodeBulk("proto") + ':' + std::to_string(this->version) + "\r\n";
+    result += encodeBulk("mode") + encodeBulk("standalone");
+
+    return result;
+}
+
+auto Resp::encode(const Command command, const Reply &reply) const -> std::string {
+    if (this->version == 3) {
+        switch (command) {
+            case Command::hgetAll:
+                return this->encodeValue(reply, Aggregate::map);
+            case Command::sdiff:
+            case Command::sinter:
+            case Command::smembers:
+            case Command::sunion:
+                return this->encodeValue(reply, Aggregate::set);
+            case Command::zincrBy:
+            case Command::zscore:
+                if (reply.getType() == Reply::Type::bulk) return ',' + std::string{reply.getText()} + "\r\n";
+
+                break;
+            default:
+                break;
+        }
+    }
+
+    return this->encodeValue(reply, Aggregate::array);
+}
+
+auto Resp::encodeValue(const Reply &reply, const Aggregate aggregate) const -> std::string {
+    switch (reply.getType()) {
+        case Reply::Type::status:
+            return '+' + std::string{reply.getText()} + "\r\n";
+        case Reply::Type::error:
+            return '-' + std::string{reply.getText()} + "\r\n";
+        case Reply::Type::integer:
+            return ':' + std::to_string(reply.getInteger()) + "\r\n";
+        case Reply::Type::bulk:
+            return encodeBulk(reply.getText());
+        case Reply::Type::nil:
+            return this->encodeNull();
+        case Reply::Type::array:
+            break;
+    }
+
+    const std::span elements{reply.getElements()};
+
+    std::string result{std::to_underlying(aggregate)};
+    result += std::to_string(aggregate == Aggregate::map ? elements.size() / 2 : elements.size()) + "\r\n";
+    for (const Reply &element : elements) result += this->encodeValue(element, Aggregate::array);
+
+    return result;
+}
+
+auto Resp::encodeNull() const -> std::string { return this->version == 3 ? "_\r\n" : "$-1\r\n"; }
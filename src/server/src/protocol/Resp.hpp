@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../../../common/command/Command.hpp"
+#include "Reply.hpp"
+
+#include <span>
+#include <string>
+#include <vector>
+
+class DatabaseManager;
+
+class Resp {
+    enum class Aggregate : char { array = '*', map = '%', set = '~' };
+
+public:
+    [[nodiscard]] static auto detect(std::span<const std::byte> data) noexcept -> std::optional<bool>;
+
+    [[nodiscard]] auto process(std::span<const std::byte> &data, DatabaseManager &databaseManager)
+        -> std::optional<std::vector<std::byte>>;
+
+private:
+    [[nodiscard]] static auto decode(std::span<const std::byte> &data, bool &isMalformed)
+        -> std::optional<std::vector<std::string_view>>;
+
+    [[nodiscard]] static auto parseLength(std::string_view &text, char prefix, bool &isMalformed) noexcept
+        -> std::optional<long>;
+
+    [[nodiscard]] static auto encodeBulk(std::string_view value) -> std::string;
+
+    [[nodiscard]] auto execute(std::span<const std::string_view> arguments, DatabaseManager &databaseManager)
+        -> std::string;
+
+    [[nodiscard]] auto hello(std::span<const std::string_view> arguments) -> std::string;
+
+    [[nodiscard]] auto encode(Command command, const Reply &reply) const -> std::string;
+
+    [[nodiscard]] auto encodeValue(const Reply &reply, Aggregate aggregate) const -> std::string;
+
+    [[nodiscard]] auto encodeNull() const -> std::string;
+
+    static constexpr unsigned long maxArgumentCount{1024 * 1024}, maxBulkSize{512UL << 20}, maxLineSize{32};
+
+    unsigned long databaseIndex{};
+    unsigned char version{2};
+};
@@ -166,6 +166,13 @@ auto Ring::submit(const Submission &submission) -> void {
             io_uring_prep_close_direct(sqe, submission.fileDescriptor);
 
             break;
+        case Submission::Type::messageRing:
+            {
+                const auto [length, data, flags]{std::get<Submission::MessageRing>(submission.parameter)};
+                io_uring_prep_msg_ring(sqe, submission.fileDescriptor, length, data, flags);
+
+                break;
+            }
     }
 
     io_uring_sqe_set_flags(sqe, submission.flags);
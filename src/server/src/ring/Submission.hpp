@@ -5,7 +5,7 @@
 #include <variant>
 
 struct Submission {
-    enum class Type : unsigned char { write, accept, read, receive, send, truncate, close };
+    enum class Type : unsigned char { write, accept, read, receive, send, truncate, close, messageRing };
 
     struct Write {
         std::span<const std::byte> buffer;
@@ -41,9 +41,15 @@ struct Submission {
 
     struct Close {};
 
+    struct MessageRing {
+        unsigned int length;
+        unsigned long data;
+        unsigned int flags;
+    };
+
     int fileDescriptor;
     unsigned int flags;
     unsigned long userData;
-    std::variant<Write, Accept, Read, Receive, Send, Truncate, Close> parameter;
+    std::variant<Write, Accept, Read, Receive, Send, Truncate, Close, MessageRing> parameter;
     Type type{static_cast<Type>(parameter.index())};
 };
@@ -0,0 +1,67 @@
+#include "../src/server/src/database/Bitmap.hpp"
+#include "Test.hpp"
+
+#include <array>
+#include <random>
+
+static auto randomBytes(std::mt19937 &engine, const unsigned long size) -> std::string {
+    std::string bytes(size, 0);
+    for (char &byte : bytes) byte = static_cast<char>(engine());
+
+    return bytes;
+}
+
+static auto testScalar() -> void {
+    const std::string bytes{"\x00\x00\x0f\xff", 4};
+    expect(Bitmap::countScalar(bytes) == 12);
+    expect(Bitmap::findScalar(bytes, true) == 16);
+    expect(Bitmap::findScalar(bytes, false) == 0);
+    expect(Bitmap::findScalar(std::string(9, 0), true) == std::string_view::npos);
+    expect(Bitmap::findScalar(std::string(9, -1), false) == std::string_view::npos);
+
+    const std::array<std::string_view, 2> sources{"\x0f\xf0\xff", "\xff\x0f"};
+    expect(Bitmap::combine(Bitmap::Operation::bitAnd, sources) == std::string_view{"\x0f\x00\x00", 3});
+    expect(Bitmap::combine(Bitmap::Operation::bitOr, sources) == "\xff\xff\xff");
+    expect(Bitmap::combine(Bitmap::Operation::bitXor, sources) == "\xf0\xff\xff");
+    expect(Bitmap::combine(Bitmap::Operation::bitNot, std::span{sources}.first(1)) ==
+           std::string_view{"\xf0\x0f\x00", 3});
+}
+
+#if defined(__x86_64__)
+static auto testAvx2() -> void {
+    if (!__builtin_cpu_supports("avx2")) return;
+
+    std::mt19937 engine{16};
+    for (unsigned long size{}; size < 300; size += 7) {
+        const std::string bytes{randomBytes(engine, size)};
+        expect(Bitmap::countAvx2(bytes) == Bitmap::countScalar(bytes));
+
+        for (const bool bit : {false, true}) {
+            for (const unsigned long position : {0UL, size / 2, size}) {
+                std::string sparse(size, bit ? 0 : -1);
+                if (position < size) sparse[position] = bytes[position];
+                expect(Bitmap::findAvx2(sparse, bit) == Bitmap::findScalar(sparse, bit));
+            }
+            expect(Bitmap::findAvx2(bytes, bit) == Bitmap::findScalar(bytes, bit));
+        }
+
+        const std::string source{randomBytes(engine, size)};
+        for (const Bitmap::Operation operation : {Bitmap::Operation::bitAnd, Bitmap::Operation::bitOr,
+                                                  Bitmap::Operation::bitXor, Bitmap::Operation::bitNot}) {
+            std::string scalar{bytes}, vectorized{bytes};
+            Bitmap::applyScalar(operation, scalar.data(), source.data(), size);
+            Bitmap::applyAvx2(operation, vectorized.data(), source.data(), size);
+            expect(scalar == vectorized);
+        }
+    }
+}
+#endif
+
+auto main() -> int {
+    testScalar();
+#if defined(__x86_64__)
+    testAvx2();
+#endif
+
+    return 0;
+}
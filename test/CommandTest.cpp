@@ -0,0 +1,90 @@
+#include "../src/common/command/Command.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+static auto testLookup() -> void {
+    for (unsigned char i{}; i < commandCount; ++i) {
+        const CommandSpecification &specification{getSpecification(static_cast<Command>(i))};
+        expect(std::to_underlying(specification.command) == i);
+        expect(toCommand(specification.name) == specification.command);
+
+        std::string lower{specification.name};
+        std::ranges::transform(lower, lower.begin(), [](const char character) noexcept {
+            return character >= 'A' && character <= 'Z' ? static_cast<char>(character - 'A' + 'a') : character;
+        });
+        expect(toCommand(lower) == specification.command);
+    }
+    expect(toCommand("hGeTaLl") == Command::hgetAll);
+    expect(toCommand("bf.add") == Command::bfAdd);
+}
+
+static auto testUnknown() -> void {
+    for (const std::string_view name : {"", "G", "GE", "GETT", "SETS", "HGETALLX", "BF.", "UNKNOWN", "GET "})
+        expect(!toCommand(name).has_value());
+}
+
+static auto testArity() -> void {
+    const CommandSpecification &get{getSpecification(Command::get)};
+    expect(!get.isArityValid(0) && get.isArityValid(1) && !get.isArityValid(2));
+
+    const CommandSpecification &del{getSpecification(Command::del)};
+    expect(!del.isArityValid(0) && del.isArityValid(1) && del.isArityValid(5));
+
+    const CommandSpecification &select{getSpecification(Command::select)};
+    expect(select.isArityValid(1) && !select.isArityValid(2));
+}
+
+static auto collectKeys(const Command command, const std::span<const std::string_view> arguments)
+    -> std::vector<std::string_view> {
+    std::vector<std::string_view> keys;
+    getSpecification(command).forEachKey(arguments, [&keys](const std::string_view key) { keys.emplace_back(key); });
+
+    return keys;
+}
+
+static auto testKeys() -> void {
+    const std::array<std::string_view, 4> mset{"a", "1", "b", "2"};
+    expect(std::ranges::equal(collectKeys(Command::mset, mset), std::array<std::string_view, 2>{"a", "b"}));
+
+    const std::array<std::string_view, 3> del{"a", "b", "c"};
+    expect(std::ranges::equal(collectKeys(Command::del, del), del));
+
+    const std::array<std::string_view, 2> rename{"from", "to"};
+    expect(std::ranges::equal(collectKeys(Command::rename, rename), rename));
+
+    const std::array<std::string_view, 1> select{"1"};
+    expect(collectKeys(Command::select, select).empty());
+
+    expect(getSpecification(Command::get).isSingleKey());
+    expect(!getSpecification(Command::del).isSingleKey());
+    expect(!getSpecification(Command::select).isSingleKey());
+}
+
+static auto testLocks() -> void {
+    std::vector<Command> lockFree;
+    for (unsigned char i{}; i < commandCount; ++i)
+        if (getSpecification(static_cast<Command>(i)).lock == CommandSpecification::Lock::none)
+            lockFree.emplace_back(static_cast<Command>(i));
+    std::ranges::sort(lockFree);
+
+    std::array expected{Command::exists, Command::get, Command::mget, Command::strlen};
+    std::ranges::sort(expected);
+    expect(std::ranges::equal(lockFree, expected));
+
+    expect(getSpecification(Command::select).lock == CommandSpecification::Lock::exclusive);
+    expect(getSpecification(Command::hget).lock == CommandSpecification::Lock::shared);
+}
+
+auto main() -> int {
+    testLookup();
+    testUnknown();
+    testArity();
+    testKeys();
+    testLocks();
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "../src/server/src/config/Config.hpp"
+#include "../src/server/src/database/Database.hpp"
+#include "Test.hpp"
+
+#include <array>
+#include <set>
+#include <string>
+#include <vector>
+
+static auto call(Database &database, auto (Database::*method)(std::span<const std::string_view>)->Reply,
+                 const std::vector<std::string_view> &arguments) -> Reply {
+    return (database.*method)(arguments);
+}
+
+static auto testScanPastKeyZero() -> void {
+    Database database{0, {}};
+    for (const std::string_view key : {"0", "1", "2", "3"})
+        expect(call(database, &Database::set, {key, "value"}).getType() == Reply::Type::status);
+
+    std::set<std::string> keys;
+    std::string cursor{"0"};
+    unsigned long calls{};
+    do {
+        const Reply reply{call(database, &Database::scan, {cursor, "COUNT", "1"})};
+        expect(reply.getType() == Reply::Type::array && ++calls <= 5);
+
+        cursor = reply.getElements()[0].getText();
+        for (const Reply &key : reply.getElements()[1].getElements()) keys.emplace(key.getText());
+    } while (cursor != "0");
+
+    expect(keys == std::set<std::string>{"0", "1", "2", "3"});
+    expect(call(database, &Database::scan, {"1"}).getType() == Reply::Type::error);
+}
+
+static auto testSketchSizeLimit() -> void {
+    Database database{0, {}};
+
+    expect(call(database, &Database::cmsInitByDim, {"cms", "4294967295", "1"}).getType() == Reply::Type::error);
+    expect(call(database, &Database::cmsInitByDim, {"cms", "65536", "4096"}).getType() == Reply::Type::error);
+    expect(call(database, &Database::cmsInitByDim, {"cms", "1024", "4"}).getType() == Reply::Type::status);
+
+    expect(call(database, &Database::topkReserve, {"topk", "10", "4294967295", "1", "0.9"}).getType() ==
+           Reply::Type::error);
+    expect(call(database, &Database::topkReserve, {"topk", "10", "1024", "4", "0.9"}).getType() ==
+           Reply::Type::status);
+
+    const std::array limited{"--maxmemory", "1mb"};
+    Config::parse(limited);
+    expect(call(database, &Database::cmsInitByDim, {"large", "1024", "1024"}).getType() == Reply::Type::error);
+
+    const std::array unlimited{"--maxmemory", "0"};
+    Config::parse(unlimited);
+    expect(call(database, &Database::cmsInitByDim, {"large", "1024", "1024"}).getType() == Reply::Type::status);
+}
+
+static auto testBloomFilterSizeLimit() -> void {
+    Database database{0, {}};
+
+    expect(call(database, &Database::bfReserve, {"large", "0.01", "1000000000"}).getType() == Reply::Type::error);
+    expect(call(database, &Database::bfReserve, {"bloom", "0.01", "1", "EXPANSION", "1000000"}).getType() ==
+           Reply::Type::status);
+    expect(call(database, &Database::bfAdd, {"bloom", "a"}).getInteger() == 1);
+
+    const std::array limited{"--maxmemory", "1mb"};
+    Config::parse(limited);
+    expect(call(database, &Database::bfAdd, {"bloom", "b"}).getType() == Reply::Type::error);
+
+    const std::array unlimited{"--maxmemory", "0"};
+    Config::parse(unlimited);
+    expect(call(database, &Database::bfAdd, {"bloom", "b"}).getInteger() == 1);
+}
+
+static auto testInPlaceString() -> void {
+    Database database{0, {}};
+
+    std::string expected(Entry::inPlaceSize, 'a');
+    expect(call(database, &Database::set, {"key", expected}).getType() == Reply::Type::status);
+
+    for (unsigned int i{}; i < 1000; ++i) {
+        expected += "bc";
+        expect(call(database, &Database::append, {"key", "bc"}).getInteger() == static_cast<long>(expected.size()));
+    }
+
+    expect(call(database, &Database::setBit, {"key", "7", "1"}).getInteger() == 0);
+    expected[0] = static_cast<char>('a' | 0x80);
+    expect(call(database, &Database::setRange, {"key", "1", "xyz"}).getInteger() ==
+           static_cast<long>(expected.size()));
+    expected.replace(1, 3, "xyz");
+    expect(call(database, &Database::bitField, {"key", "SET", "u8", "32", "100"}).getElements()[0].getInteger() ==
+           'a');
+    expected[4] = 'd';
+
+    expect(call(database, &Database::get, {"key"}).getText() == expected);
+    expect(call(database, &Database::strlen, {"key"}).getInteger() == static_cast<long>(expected.size()));
+    expect(call(database, &Database::mget, {"key", "missing"}).getElements()[0].getText() == expected);
+    expect(call(database, &Database::getRange, {"key", "0", "4"}).getText() == expected.substr(0, 5));
+}
+
+auto main() -> int {
+    testScanPastKeyZero();
+    testSketchSizeLimit();
+    testBloomFilterSizeLimit();
+    testInPlaceString();
+
+    return 0;
+}
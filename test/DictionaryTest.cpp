@@ -0,0 +1,71 @@
+#include "../src/server/src/database/Dictionary.hpp"
+#include "Test.hpp"
+
+#include <set>
+#include <string>
+
+static auto testInsertFindErase() -> void {
+    Dictionary<std::pair<std::string, std::string>> dictionary;
+    for (unsigned long i{}; i < 1000; ++i) expect(dictionary.emplace("field:" + std::to_string(i), std::to_string(i)));
+    expect(!dictionary.emplace("field:0", "other"));
+    expect(dictionary.size() == 1000);
+
+    for (unsigned long i{}; i < 1000; ++i) {
+        const auto element{dictionary.find("field:" + std::to_string(i))};
+        expect(element != nullptr && element->second == std::to_string(i));
+    }
+    expect(dictionary.find("field:1000") == nullptr);
+
+    for (unsigned long i{}; i < 1000; i += 2) {
+        const std::optional element{dictionary.erase("field:" + std::to_string(i))};
+        expect(element.has_value() && element->first == "field:" + std::to_string(i));
+    }
+    expect(!dictionary.erase("field:0").has_value());
+    expect(dictionary.size() == 500);
+
+    unsigned long count{};
+    dictionary.traverse([&count](const auto &) { ++count; });
+    expect(count == 500);
+}
+
+static auto scanAll(const Dictionary<std::string> &dictionary, const unsigned long count) -> std::set<std::string> {
+    std::set<std::string> elements;
+    unsigned long cursor{};
+    do {
+        cursor = dictionary.scan(cursor, count, [&elements](const std::string &element) { elements.emplace(element); });
+    } while (cursor != 0);
+
+    return elements;
+}
+
+static auto testScan() -> void {
+    Dictionary<std::string> dictionary;
+    expect(scanAll(dictionary, 10).empty());
+
+    for (unsigned long i{}; i < 1000; ++i) static_cast<void>(dictionary.emplace(std::to_string(i)));
+    expect(scanAll(dictionary, 1).size() == 1000);
+    expect(scanAll(dictionary, 10000).size() == 1000);
+}
+
+static auto testScanAcrossGrowth() -> void {
+    Dictionary<std::string> dictionary;
+    for (unsigned long i{}; i < 100; ++i) static_cast<void>(dictionary.emplace("old:" + std::to_string(i)));
+
+    std::set<std::string> elements;
+    unsigned long cursor{}, added{};
+    do {
+        cursor = dictionary.scan(cursor, 5, [&elements](const std::string &element) { elements.emplace(element); });
+        for (const unsigned long last{added + 50}; added < last; ++added)
+            static_cast<void>(dictionary.emplace("new:" + std::to_string(added)));
+    } while (cursor != 0);
+
+    for (unsigned long i{}; i < 100; ++i) expect(elements.contains("old:" + std::to_string(i)));
+}
+
+auto main() -> int {
+    testInsertFindErase();
+    testScan();
+    testScanAcrossGrowth();
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "../src/server/src/database/Epoch.hpp"
+#include "Test.hpp"
+
+#include <latch>
+#include <thread>
+
+static std::atomic_uint deletedCount;
+
+static auto deleteInteger(void *const pointer) noexcept -> void {
+    delete static_cast<int *>(pointer);
+    deletedCount.fetch_add(1, std::memory_order::relaxed);
+}
+
+static auto advance() -> void {
+    for (unsigned int i{}; i < 4; ++i) {
+        Epoch::tryAdvance();
+        Epoch::reclaim();
+    }
+}
+
+static auto testReclaimAfterGracePeriod() -> void {
+    deletedCount = 0;
+
+    for (unsigned int i{}; i < 10; ++i) Epoch::retire(new int{}, deleteInteger);
+    expect(deletedCount == 0);
+
+    advance();
+    expect(deletedCount == 10);
+}
+
+static auto testGuardBlocksReclamation() -> void {
+    deletedCount = 0;
+
+    std::latch isGuarded{1}, isRetired{1};
+    std::jthread reader{[&isGuarded, &isRetired] {
+        const Epoch::Guard guard;
+        isGuarded.count_down();
+
+        isRetired.wait();
+    }};
+    isGuarded.wait();
+
+    Epoch::retire(new int{}, deleteInteger);
+    advance();
+    expect(deletedCount == 0);
+
+    isRetired.count_down();
+    reader.join();
+
+    advance();
+    expect(deletedCount == 1);
+}
+
+static auto testNestedGuard() -> void {
+    deletedCount = 0;
+
+    {
+        const Epoch::Guard outer;
+        {
+            const Epoch::Guard inner;
+        }
+
+        Epoch::retire(new int{}, deleteInteger);
+        for (unsigned int i{}; i < 4; ++i) Epoch::tryAdvance();
+    }
+    expect(deletedCount == 0);
+
+    advance();
+    expect(deletedCount == 1);
+}
+
+auto main() -> int {
+    testReclaimAfterGracePeriod();
+    testGuardBlocksReclamation();
+    testNestedGuard();
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "../src/common/frame/Frame.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+
+static auto toBytes(const unsigned long size) -> std::vector<std::byte> {
+    std::vector<std::byte> bytes(sizeof(size));
+    std::memcpy(bytes.data(), &size, sizeof(size));
+
+    return bytes;
+}
+
+static auto testRoundTrip() -> void {
+    const std::array<std::string_view, 3> arguments{"SET", "key", ""};
+
+    std::vector<std::byte> payload;
+    Frame::encodeArguments(payload, arguments);
+
+    std::vector<std::byte> buffer;
+    Frame::encode(buffer, payload);
+    Frame::encode(buffer, {});
+
+    std::span<const std::byte> data{buffer};
+    const std::optional first{Frame::decode(data)};
+    expect(first.has_value() && std::ranges::equal(*first, payload));
+
+    const std::optional decodedArguments{Frame::decodeArguments(*first)};
+    expect(decodedArguments.has_value() && std::ranges::equal(*decodedArguments, arguments));
+
+    const std::optional second{Frame::decode(data)};
+    expect(second.has_value() && second->empty());
+    expect(data.empty());
+    expect(!Frame::decode(data).has_value());
+}
+
+static auto testPartialFrame() -> void {
+    std::vector<std::byte> buffer;
+    const std::string payload{"payload"};
+    Frame::encode(buffer, std::as_bytes(std::span{payload}));
+
+    for (unsigned long size{}; size < buffer.size(); ++size) {
+        std::span<const std::byte> data{buffer.data(), size};
+        expect(!Frame::decode(data).has_value());
+        expect(data.size() == size);
+    }
+
+    std::span<const std::byte> data{buffer};
+    expect(Frame::decode(data).has_value());
+}
+
+static auto testOversizedFrame() -> void {
+    const std::vector small{toBytes(16)}, large{toBytes(-1UL)};
+
+    expect(!Frame::isOversized({}));
+    expect(!Frame::isOversized(small));
+    expect(Frame::isOversized(large));
+
+    std::span<const std::byte> data{large};
+    expect(!Frame::decode(data).has_value());
+    expect(data.size() == large.size());
+}
+
+static auto testMalformedArguments() -> void {
+    std::vector<std::byte> buffer;
+    const std::array<std::string_view, 1> arguments{"GET"};
+    Frame::encodeArguments(buffer, arguments);
+
+    expect(Frame::decodeArguments({}).has_value() && Frame::decodeArguments({})->empty());
+    expect(!Frame::decodeArguments(std::span{buffer}.first(buffer.size() - 1)).has_value());
+    expect(!Frame::decodeArguments(std::span{buffer}.first(sizeof(unsigned long) - 1)).has_value());
+
+    const std::vector length{toBytes(100)};
+    buffer.insert(buffer.cend(), length.cbegin(), length.cend());
+    expect(!Frame::decodeArguments(buffer).has_value());
+}
+
+auto main() -> int {
+    testRoundTrip();
+    testPartialFrame();
+    testOversizedFrame();
+    testMalformedArguments();
+
+    return 0;
+}
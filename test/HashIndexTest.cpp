@@ -0,0 +1,113 @@
+#include "../src/server/src/database/Arena.hpp"
+#include "../src/server/src/database/Epoch.hpp"
+#include "../src/server/src/database/HashIndex.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+static auto createNodes(Arena &arena, const unsigned long first, const unsigned long last) -> std::vector<Node *> {
+    std::vector<Node *> nodes;
+    for (unsigned long i{first}; i < last; ++i)
+        nodes.emplace_back(Node::create(arena, "key:" + std::to_string(i), Entry{static_cast<long>(i)}, 0));
+
+    return nodes;
+}
+
+static auto destroyNodes(Arena &arena, const std::span<Node *const> nodes) -> void {
+    for (Node *const node : nodes) Node::destroy(arena, node);
+}
+
+static auto testGrowth() -> void {
+    Arena arena;
+    HashIndex hashIndex;
+
+    const std::vector nodes{createNodes(arena, 0, 10000)};
+    for (Node *const node : nodes) hashIndex.insert(node);
+
+    const Epoch::Guard guard;
+    for (Node *const node : nodes) expect(hashIndex.find(node->getKey()) == node);
+    expect(hashIndex.find("key:10000") == nullptr);
+    expect(hashIndex.sample(0, nodes.size() * 2).size() == nodes.size());
+
+    destroyNodes(arena, nodes);
+}
+
+static auto testEraseAndReuse() -> void {
+    Arena arena;
+    HashIndex hashIndex;
+
+    const std::vector nodes{createNodes(arena, 0, 1000)};
+    for (Node *const node : nodes) hashIndex.insert(node);
+    for (unsigned long i{}; i < nodes.size(); i += 2) expect(hashIndex.erase(nodes[i]->getKey()) == nodes[i]);
+    expect(hashIndex.erase(nodes.front()->getKey()) == nullptr);
+
+    const Epoch::Guard guard;
+    for (unsigned long i{}; i < nodes.size(); ++i)
+        expect((hashIndex.find(nodes[i]->getKey()) == nullptr) == (i % 2 == 0));
+    expect(hashIndex.sample(0, nodes.size()).size() == nodes.size() / 2);
+
+    for (unsigned long i{}; i < nodes.size(); i += 2) hashIndex.insert(nodes[i]);
+    for (Node *const node : nodes) expect(hashIndex.find(node->getKey()) == node);
+
+    destroyNodes(arena, nodes);
+}
+
+static auto testSetEntry() -> void {
+    Arena arena;
+    HashIndex hashIndex;
+
+    Node *const node{Node::create(arena, "key", Entry{1L}, 0)};
+    hashIndex.insert(node);
+    node->setEntry(Entry{2L});
+
+    const Epoch::Guard guard;
+    expect(hashIndex.find("key") == node);
+    expect(node->getEntry().getInteger() == 2);
+
+    destroyNodes(arena, std::array{node});
+}
+
+static auto testConcurrentGrowth() -> void {
+    constexpr unsigned long threadCount{4}, keyCount{5000};
+
+    Arena arena;
+    HashIndex hashIndex;
+
+    const std::vector nodes{createNodes(arena, 0, threadCount * keyCount)};
+    std::atomic_bool isDone;
+    std::jthread reader{[&hashIndex, &nodes, &isDone] {
+        while (!isDone.load(std::memory_order::acquire)) {
+            const Epoch::Guard guard;
+
+            for (unsigned long i{}; i < nodes.size(); i += 97)
+                if (Node *const node{hashIndex.find(nodes[i]->getKey())}; node != nullptr) expect(node == nodes[i]);
+        }
+    }};
+
+    {
+        std::vector<std::jthread> writers;
+        for (unsigned long thread{}; thread < threadCount; ++thread) {
+            writers.emplace_back([&hashIndex, &nodes, thread] {
+                for (unsigned long i{thread}; i < nodes.size(); i += threadCount) hashIndex.insert(nodes[i]);
+            });
+        }
+    }
+    isDone.store(true, std::memory_order::release);
+    reader.join();
+
+    const Epoch::Guard guard;
+    for (Node *const node : nodes) expect(hashIndex.find(node->getKey()) == node);
+
+    destroyNodes(arena, nodes);
+}
+
+auto main() -> int {
+    testGrowth();
+    testEraseAndReuse();
+    testSetEntry();
+    testConcurrentGrowth();
+
+    return 0;
+}
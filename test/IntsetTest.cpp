@@ -0,0 +1,163 @@
+#include "../src/server/src/config/Config.hpp"
+#include "../src/server/src/database/Intset.hpp"
+#include "../src/server/src/database/Set.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <string>
+
+static auto isIntset(const Set &set) -> bool { return set.getMemory() <= set.size() * sizeof(long) * 2; }
+
+static auto fill(Set &set, const long first, const long last) -> void {
+    for (long i{first}; i < last; ++i) expect(set.insert(std::to_string(i)));
+}
+
+static auto testConversionAtConfiguredLimit() -> void {
+    Set set;
+    fill(set, 0, static_cast<long>(Config::getSetMaxIntsetEntries()));
+    expect(isIntset(set));
+
+    expect(!set.insert("0"));
+    expect(isIntset(set));
+
+    expect(set.insert(std::to_string(Config::getSetMaxIntsetEntries())));
+    expect(!isIntset(set));
+    expect(set.size() == Config::getSetMaxIntsetEntries() + 1);
+    for (unsigned long i{}; i <= Config::getSetMaxIntsetEntries(); ++i) expect(set.contains(std::to_string(i)));
+}
+
+static auto testConversionOnNonInteger() -> void {
+    Set set;
+    fill(set, -8, 8);
+    expect(isIntset(set));
+
+    expect(set.insert("element"));
+    expect(set.size() == 17);
+    expect(set.contains("element") && set.contains("-8") && set.contains("7"));
+}
+
+static auto testLargeSet() -> void {
+    const std::array arguments{"--set-max-intset-entries", "1000000"};
+    Config::parse(arguments);
+
+    std::mt19937 engine{11};
+    std::vector<long> elements(100000);
+    std::iota(elements.begin(), elements.end(), 0);
+    std::ranges::shuffle(elements, engine);
+
+    Set set;
+    for (const long element : elements) expect(set.insert(std::to_string(element)));
+    expect(isIntset(set) && set.size() == elements.size());
+
+    for (long i{}; i < static_cast<long>(elements.size()); i += 2) expect(set.erase(std::to_string(i)));
+    expect(set.size() == elements.size() / 2);
+    for (long i{}; i < static_cast<long>(elements.size()); ++i) expect(set.contains(std::to_string(i)) == (i % 2 != 0));
+
+    long previous{-1};
+    set.traverse([&previous](const std::string_view element) {
+        const long integer{std::stol(std::string{element})};
+        expect(integer > previous);
+        previous = integer;
+    });
+
+    const std::array defaults{"--set-max-intset-entries", "512"};
+    Config::parse(defaults);
+}
+
+static auto randomSorted(std::mt19937 &engine, const unsigned long size, const long range) -> std::vector<long> {
+    std::uniform_int_distribution distribution{-range, range};
+
+    std::vector<long> elements;
+    for (unsigned long i{}; i < size; ++i) elements.emplace_back(distribution(engine));
+    std::ranges::sort(elements);
+    elements.erase(std::ranges::unique(elements).begin(), elements.end());
+
+    return elements;
+}
+
+static auto toIntset(const std::span<const long> elements) -> Intset {
+    Intset intset;
+    for (const long element : elements) intset.insert(element);
+
+    return intset;
+}
+
+static auto expectKernel(const Intset::Kernel kernel, const std::span<const long> left,
+                         const std::span<const long> right) -> void {
+    std::vector<long> expected;
+    std::ranges::set_intersection(left, right, std::back_inserter(expected));
+
+    std::vector<long> output(std::min(left.size(), right.size()));
+    output.resize(kernel(left.data(), left.size(), right.data(), right.size(), output.data()));
+    expect(output == expected);
+    expect(kernel(left.data(), left.size(), right.data(), right.size(), nullptr) == expected.size());
+    expect(kernel(right.data(), right.size(), left.data(), left.size(), nullptr) == expected.size());
+}
+
+static auto testKernels() -> void {
+    std::vector<Intset::Kernel> kernels{Intset::intersectScalar};
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("sse4.1")) kernels.emplace_back(Intset::intersectSse);
+    if (__builtin_cpu_supports("avx2")) kernels.emplace_back(Intset::intersectAvx2);
+#endif
+
+    std::mt19937 engine{42};
+    for (const Intset::Kernel kernel : kernels) {
+        expectKernel(kernel, {}, std::vector<long>{1, 2, 3});
+        expectKernel(kernel, std::vector<long>{1, 2, 3, 4, 5, 6, 7, 8}, std::vector<long>{1, 2, 3, 4, 5, 6, 7, 8});
+        expectKernel(kernel, std::vector<long>{1, 3, 5, 7, 9, 11, 13}, std::vector<long>{2, 4, 6, 8, 10, 12, 14});
+        expectKernel(kernel, std::vector<long>{-5, 0, 5, 9, 10, 11, 12, 20, 21},
+                     std::vector<long>{-6, -5, 1, 9, 12, 13, 21});
+
+        for (unsigned long i{}; i < 200; ++i) {
+            const std::vector left{randomSorted(engine, engine() % 64, 96)},
+                right{randomSorted(engine, engine() % 64, 96)};
+            expectKernel(kernel, left, right);
+        }
+    }
+}
+
+static auto testIntersect() -> void {
+    std::mt19937 engine{7};
+    for (const auto [smallSize, largeSize] : {std::pair{16UL, 4096UL}, {5000UL, 20000UL}, {30000UL, 30000UL}}) {
+        const std::vector small{randomSorted(engine, smallSize, 1 << 15)},
+            large{randomSorted(engine, largeSize, 1 << 15)};
+
+        std::vector<long> expected;
+        std::ranges::set_intersection(small, large, std::back_inserter(expected));
+
+        std::vector<long> elements;
+        Intset::intersect(toIntset(small), toIntset(large)).traverse([&elements](const long element) {
+            elements.emplace_back(element);
+        });
+        expect(elements == expected);
+        expect(Intset::intersectCount(toIntset(large), toIntset(small), 0) == expected.size());
+        expect(Intset::intersectCount(toIntset(large), toIntset(small), 10) == std::min(expected.size(), 10UL));
+    }
+}
+
+static auto testIntersectCountLimit() -> void {
+    Set integers, strings;
+    fill(integers, 0, 100);
+    for (long i{}; i < 1000; ++i) expect(strings.insert(std::to_string(i)));
+    expect(strings.insert("element"));
+
+    const std::array<const Set *, 2> sets{&integers, &strings};
+    expect(Set::intersectCount(sets, 0) == 100);
+    expect(Set::intersectCount(sets, 7) == 7);
+    expect(Set::intersect(sets).size() == 100);
+}
+
+auto main() -> int {
+    testConversionAtConfiguredLimit();
+    testConversionOnNonInteger();
+    testLargeSet();
+    testKernels();
+    testIntersect();
+    testIntersectCountLimit();
+
+    return 0;
+}
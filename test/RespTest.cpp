@@ -0,0 +1,108 @@
+#include "../src/common/frame/Frame.hpp"
+#include "../src/server/src/fileDescriptor/DatabaseManager.hpp"
+#include "../src/server/src/protocol/Resp.hpp"
+#include "Test.hpp"
+
+#include <string>
+
+static auto toBytes(const std::string_view text) -> std::span<const std::byte> {
+    return std::as_bytes(std::span{text});
+}
+
+static auto process(Resp &resp, DatabaseManager &databaseManager, const std::string_view request) -> std::string {
+    std::span data{toBytes(request)};
+    const std::optional response{resp.process(data, databaseManager)};
+    expect(response.has_value() && data.empty());
+    if (!response.has_value()) return {};
+
+    return {reinterpret_cast<const char *>(response->data()), response->size()};
+}
+
+static auto testDetect() -> void {
+    expect(!Resp::detect({}).has_value());
+    expect(!Resp::detect(toBytes("*1\r\n")).has_value());
+    expect(Resp::detect(toBytes("*1\r\n$4\r\nPING\r\n")) == true);
+    expect(Resp::detect(toBytes("PING")) == false);
+
+    std::vector<std::byte> framed;
+    Frame::encode(framed, std::vector<std::byte>('*'));
+    expect(framed.front() == std::byte{'*'});
+    expect(Resp::detect(framed) == false);
+}
+
+static auto testReplyToString() -> void {
+    expect(Reply{Reply::Type::status, "OK"}.toString() == "OK");
+    expect(Reply{Reply::Type::error, "ERR syntax error"}.toString() == "(error) ERR syntax error");
+    expect(Reply{-1L}.toString() == "(integer) -1");
+    expect(Reply{Reply::Type::bulk, "value"}.toString() == "\"value\"");
+    expect(Reply{}.toString() == "(nil)");
+    expect(Reply{std::vector<Reply>{}}.toString() == "(empty array)");
+
+    std::vector<Reply> inner;
+    inner.emplace_back(Reply::Type::bulk, "b");
+    inner.emplace_back(Reply::Type::bulk, "c");
+    std::vector<Reply> outer;
+    outer.emplace_back(Reply::Type::bulk, "a");
+    outer.emplace_back(std::move(inner));
+    expect(Reply{std::move(outer)}.toString() == "1) \"a\"\n2) 1) \"b\"\n   2) \"c\"");
+}
+
+static auto testProcess() -> void {
+    DatabaseManager databaseManager{-1};
+    Resp resp;
+
+    expect(process(resp, databaseManager, "*1\r\n$4\r\nPING\r\n") == "+PONG\r\n");
+    expect(process(resp, databaseManager, "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$11\r\n(integer) 5\r\n") == "+OK\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n") == "$11\r\n(integer) 5\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$4\r\nINCR\r\n$3\r\nkey\r\n") ==
+           "-ERR value is not an integer or out of range\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$4\r\nINCR\r\n$7\r\ncounter\r\n") == ":1\r\n");
+    expect(process(resp, databaseManager, "*1\r\n$7\r\nUNKNOWN\r\n") == "-ERR unknown command 'UNKNOWN'\r\n");
+
+    expect(process(resp, databaseManager, "*4\r\n$4\r\nHSET\r\n$4\r\nhash\r\n$1\r\nf\r\n$6\r\nx\n2) y\r\n") ==
+           ":1\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$7\r\nHGETALL\r\n$4\r\nhash\r\n") ==
+           "*2\r\n$1\r\nf\r\n$6\r\nx\n2) y\r\n");
+    expect(process(resp, databaseManager, "*3\r\n$4\r\nMGET\r\n$4\r\nhash\r\n$7\r\ncounter\r\n") ==
+           "*2\r\n$-1\r\n$1\r\n1\r\n");
+
+    expect(process(resp, databaseManager, "*3\r\n$3\r\nSET\r\n$5\r\nempty\r\n$0\r\n\r\n") == "+OK\r\n");
+    expect(process(resp, databaseManager, "*3\r\n$4\r\nMGET\r\n$5\r\nempty\r\n$7\r\nmissing\r\n") ==
+           "*2\r\n$0\r\n\r\n$-1\r\n");
+    expect(process(resp, databaseManager, "*4\r\n$5\r\nRPUSH\r\n$4\r\nlist\r\n$0\r\n\r\n$1\r\na\r\n") == ":2\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$4\r\nLPOP\r\n$4\r\nlist\r\n") == "$0\r\n\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$4\r\nLPOP\r\n$4\r\nlist\r\n") == "$1\r\na\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$4\r\nLPOP\r\n$4\r\nlist\r\n") == "$-1\r\n");
+
+    expect(process(resp, databaseManager, "*2\r\n$5\r\nHELLO\r\n$1\r\n3\r\n").starts_with("%4\r\n"));
+    expect(process(resp, databaseManager, "*2\r\n$7\r\nHGETALL\r\n$4\r\nhash\r\n") ==
+           "%1\r\n$1\r\nf\r\n$6\r\nx\n2) y\r\n");
+
+    expect(process(resp, databaseManager, "*2\r\n$6\r\nSELECT\r\n$1\r\n1\r\n") == "+OK\r\n");
+    expect(process(resp, databaseManager, "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n") == "_\r\n");
+}
+
+static auto testPartialAndMalformed() -> void {
+    DatabaseManager databaseManager{-1};
+    Resp resp;
+
+    const std::string_view request{"*2\r\n$4\r\nECHO\r\n$5\r\nhello\r\n"};
+    for (unsigned long size{}; size < request.size(); ++size) {
+        std::span data{toBytes(request.substr(0, size))};
+        const std::optional response{resp.process(data, databaseManager)};
+        expect(response.has_value() && response->empty() && data.size() == size);
+    }
+    expect(process(resp, databaseManager, request) == "$5\r\nhello\r\n");
+
+    std::span data{toBytes("*1\r\n+PING\r\n")};
+    expect(!resp.process(data, databaseManager).has_value());
+}
+
+auto main() -> int {
+    testDetect();
+    testReplyToString();
+    testProcess();
+    testPartialAndMalformed();
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "../src/server/src/database/ShardLock.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static auto testSequenceFollowsLockOrder() -> void {
+    ShardLock shardLock;
+    unsigned long value{};
+
+    std::vector<std::vector<std::pair<unsigned long, unsigned long>>> records(4);
+    {
+        std::vector<std::jthread> writers;
+        for (auto &writerRecords : records) {
+            writers.emplace_back([&shardLock, &value, &writerRecords] {
+                for (unsigned int i{}; i < 10000; ++i) {
+                    ShardLock::reset();
+
+                    unsigned long written;
+                    {
+                        const std::lock_guard lockGuard{shardLock};
+                        written = ++value;
+                    }
+                    std::this_thread::yield();
+
+                    writerRecords.emplace_back(ShardLock::takeSequence(), written);
+                }
+            });
+        }
+    }
+
+    std::vector<std::pair<unsigned long, unsigned long>> merged;
+    for (const auto &writerRecords : records)
+        merged.insert(merged.cend(), writerRecords.cbegin(), writerRecords.cend());
+    std::ranges::sort(merged);
+
+    expect(merged.size() == 40000);
+    for (unsigned long i{}; i < merged.size(); ++i) expect(merged[i].second == i + 1);
+}
+
+static auto testOneStampPerCommand() -> void {
+    ShardLock first, second;
+
+    ShardLock::reset();
+    {
+        const std::scoped_lock scopedLock{first, second};
+    }
+    {
+        const std::shared_lock sharedLock{first};
+    }
+    const unsigned long sequence{ShardLock::takeSequence()};
+
+    expect(ShardLock::takeSequence() == sequence + 1);
+}
+
+auto main() -> int {
+    testSequenceFollowsLockOrder();
+    testOneStampPerCommand();
+
+    return 0;
+}
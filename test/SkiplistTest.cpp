@@ -0,0 +1,142 @@
+#include "../src/server/src/database/Arena.hpp"
+#include "../src/server/src/database/Epoch.hpp"
+#include "../src/server/src/database/Skiplist.hpp"
+#include "Test.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+
+static auto getKeys(const Skiplist &skiplist) -> std::vector<std::string> {
+    std::vector<std::string> keys;
+    skiplist.traverse([&keys](Node *const node) { keys.emplace_back(node->getKey()); });
+
+    return keys;
+}
+
+static auto testInsertFindErase() -> void {
+    Arena arena;
+    const Skiplist skiplist{arena, {}};
+
+    std::vector<std::string> keys;
+    for (unsigned int i{}; i < 1000; ++i) keys.emplace_back("key:" + std::to_string(i * 7919 % 1000));
+    for (const auto &key : keys)
+        skiplist.insert(Node::create(arena, key, Entry{std::string{key}}, Skiplist::randomLevel()));
+
+    std::vector sortedKeys{keys};
+    std::ranges::sort(sortedKeys);
+    expect(getKeys(skiplist) == sortedKeys);
+
+    {
+        const Epoch::Guard guard;
+
+        for (const auto &key : keys) {
+            Node *const node{skiplist.find(key)};
+            expect(node != nullptr && node->getKey() == key && node->getEntry().toString() == key);
+        }
+        expect(skiplist.find("key:") == nullptr);
+        expect(skiplist.find("key:1000") == nullptr);
+    }
+
+    for (unsigned int i{}; i < keys.size(); i += 2) {
+        Node *const node{skiplist.erase(keys[i])};
+        expect(node != nullptr && node->getKey() == keys[i]);
+        Node::retire(arena, node);
+
+        expect(skiplist.erase(keys[i]) == nullptr);
+    }
+
+    const Epoch::Guard guard;
+    for (unsigned int i{}; i < keys.size(); ++i) expect((skiplist.find(keys[i]) == nullptr) == (i % 2 == 0));
+}
+
+static auto testSharedPrefix() -> void {
+    Arena arena;
+    const Skiplist skiplist{arena, {}};
+
+    const std::vector<std::string> keys{"prefix00", "prefix00a", "prefix00b", "prefix0", "prefix01", ""};
+    for (const auto &key : keys)
+        skiplist.insert(Node::create(arena, key, Entry{std::string{key}}, Skiplist::randomLevel()));
+
+    std::vector sortedKeys{keys};
+    std::ranges::sort(sortedKeys);
+    expect(getKeys(skiplist) == sortedKeys);
+
+    std::vector<std::string> tail;
+    skiplist.traverse("prefix00a", [&tail](Node *const node) {
+        tail.emplace_back(node->getKey());
+
+        return tail.size() < 2;
+    });
+    expect(tail == std::vector<std::string>{"prefix00a", "prefix00b"});
+}
+
+static auto testBulkLoad() -> void {
+    std::vector<std::vector<std::byte>> serializations;
+    for (const std::string key : {"a", "b", "c", "e", "d", "b"})
+        serializations.emplace_back(Entry{std::string{key} + "-value"}.serialize(key));
+    std::vector<std::span<const std::byte>> serializedEntries;
+    for (const auto &serialization : serializations)
+        serializedEntries.emplace_back(std::span{serialization}.subspan(sizeof(unsigned long)));
+
+    Arena arena;
+    const Skiplist skiplist{arena, serializedEntries};
+
+    expect(getKeys(skiplist) == std::vector<std::string>{"a", "b", "c", "d", "e"});
+
+    const Epoch::Guard guard;
+    expect(skiplist.find("d")->getEntry().toString() == "d-value");
+}
+
+static auto testConcurrentInsertErase() -> void {
+    constexpr unsigned int threadCount{4}, keyCount{2000};
+
+    Arena arena;
+    const Skiplist skiplist{arena, {}};
+
+    std::vector<std::jthread> threads;
+    for (unsigned int thread{}; thread < threadCount; ++thread) {
+        threads.emplace_back([&arena, &skiplist, thread] {
+            std::mt19937 generator{thread};
+            std::vector<unsigned int> numbers(keyCount);
+            for (unsigned int i{}; i < keyCount; ++i) numbers[i] = i * threadCount + thread;
+            std::ranges::shuffle(numbers, generator);
+
+            for (const unsigned int number : numbers) {
+                const std::string key{std::to_string(number)};
+                skiplist.insert(Node::create(arena, key, Entry{std::string{key}}, Skiplist::randomLevel()));
+            }
+            for (const unsigned int number : numbers) {
+                if (number % 3 != 0) continue;
+
+                Node *const node{skiplist.erase(std::to_string(number))};
+                expect(node != nullptr);
+                Node::retire(arena, node);
+            }
+
+            Epoch::reclaim();
+        });
+    }
+    threads.clear();
+
+    std::set<std::string> expectedKeys;
+    for (unsigned int number{}; number < threadCount * keyCount; ++number)
+        if (number % 3 != 0) expectedKeys.emplace(std::to_string(number));
+
+    expect(getKeys(skiplist) == std::vector<std::string>{expectedKeys.cbegin(), expectedKeys.cend()});
+
+    const Epoch::Guard guard;
+    for (unsigned int number{}; number < threadCount * keyCount; ++number)
+        expect((skiplist.find(std::to_string(number)) == nullptr) == (number % 3 == 0));
+}
+
+auto main() -> int {
+    testInsertFindErase();
+    testSharedPrefix();
+    testBulkLoad();
+    testConcurrentInsertErase();
+
+    return 0;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdlib>
+#include <print>
+#include <source_location>
+
+inline auto expect(const bool condition, const std::source_location sourceLocation = std::source_location::current())
+    -> void {
+    if (condition) return;
+
+    std::println(stderr, "{}:{}: expectation failed", sourceLocation.file_name(), sourceLocation.line());
+    std::exit(EXIT_FAILURE);
+}